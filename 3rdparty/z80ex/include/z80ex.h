@@ -84,6 +84,10 @@ extern Z80EX_BYTE z80ex_last_op_type(Z80EX_CONTEXT *cpu);
 /*set T-state callback*/
 extern void z80ex_set_tstate_callback(Z80EX_CONTEXT *cpu, z80ex_tstate_cb cb_fn, void *user_data);
 
+/*set flat 64k memory to be accessed directly instead of memory read/write callbacks.
+NULL restores callbacks usage*/
+extern void z80ex_set_memory(Z80EX_CONTEXT *cpu, Z80EX_BYTE *memory);
+
 /*set RETI callback*/
 extern void z80ex_set_reti_callback(Z80EX_CONTEXT *cpu, z80ex_reti_cb cb_fn, void *user_data);
 
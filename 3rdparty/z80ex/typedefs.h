@@ -70,6 +70,9 @@ struct _z80_cpu_context {
 	z80ex_reti_cb reti_cb;
 	void *reti_cb_user_data;
 	
+	/*flat 64k memory used instead of mread_cb/mwrite_cb if not NULL*/
+	Z80EX_BYTE *memory;
+	
 	/*other stuff*/
 	regpair tmpword;
 	regpair tmpaddr;
@@ -175,6 +175,11 @@ LIB_EXPORT void z80ex_set_tstate_callback(Z80EX_CONTEXT *cpu, z80ex_tstate_cb cb
 	cpu->tstate_cb_user_data=user_data;
 }
 
+LIB_EXPORT void z80ex_set_memory(Z80EX_CONTEXT *cpu, Z80EX_BYTE *memory)
+{
+	cpu->memory=memory;
+}
+
 LIB_EXPORT void z80ex_set_reti_callback(Z80EX_CONTEXT *cpu, z80ex_reti_cb cb_fn, void *user_data)
 {
 	cpu->reti_cb=cb_fn;
@@ -196,10 +201,10 @@ LIB_EXPORT int z80ex_nmi(Z80EX_CONTEXT *cpu)
 
 	TSTATES(5); 
 	
-	cpu->mwrite_cb(cpu, --SP, cpu->pc.b.h, cpu->mwrite_cb_user_data); /*PUSH PC -- high byte */
+	MEM_WRITE(--SP, cpu->pc.b.h); /*PUSH PC -- high byte */
 	TSTATES(3);
 		
-	cpu->mwrite_cb(cpu, --SP, cpu->pc.b.l, cpu->mwrite_cb_user_data); /*PUSH PC -- low byte */
+	MEM_WRITE(--SP, cpu->pc.b.l); /*PUSH PC -- low byte */
 	TSTATES(3);
 	
 	PC=0x0066;
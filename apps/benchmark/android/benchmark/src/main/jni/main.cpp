@@ -66,6 +66,11 @@ namespace
         Env->CallVoidMethod(Visitor, Pass, jcategory, jname, res);
       }
     }
+
+    void OnQualityTest(const Benchmark::QualityTest& /*test*/) override
+    {
+      //results are not comparable with performance indices, so not reported
+    }
   private:
     JNIEnv* const Env;
     const jobject Visitor;
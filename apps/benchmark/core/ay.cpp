@@ -73,6 +73,31 @@ namespace
     const Devices::AYM::InterpolationType Interpolate;
   };
 
+  void InitChunk(Devices::AYM::DataChunk& chunk)
+  {
+    using namespace Devices::AYM;
+    chunk.Data[Registers::MIXER] = Registers::MASK_TONEA | Registers::MASK_NOISEB | Registers::MASK_TONEC | Registers::MASK_NOISEC;
+    chunk.Data[Registers::VOLA] = 0;
+    chunk.Data[Registers::VOLB] = Registers::MASK_VOL;
+    chunk.Data[Registers::VOLC] = Registers::MASK_ENV | Registers::MASK_VOL;
+  }
+
+  void FillChunk(uint_t val, Devices::AYM::DataChunk& chunk)
+  {
+    using namespace Devices::AYM;
+    const uint_t tonLo = (val &    0xff);
+    const uint_t tonHi = (val &   0xf00) >> 8;
+    const uint_t noise = (val & 0x1f000) >> 12;
+    const uint_t envLo = tonLo;
+    const uint_t envHi = (val &  0xff00) >> 8;
+    const uint_t envTp = (val & 0xf0000) >> 16;
+    chunk.Data[Registers::TONEA_L] = chunk.Data[Registers::TONEB_L] = chunk.Data[Registers::TONEC_L] = tonLo;
+    chunk.Data[Registers::TONEA_H] = chunk.Data[Registers::TONEB_H] = chunk.Data[Registers::TONEC_H] = tonHi;
+    chunk.Data[Registers::TONEN] = noise;
+    chunk.Data[Registers::TONEE_L] = envLo;
+    chunk.Data[Registers::TONEE_H] = envHi;
+    chunk.Data[Registers::ENV] = envTp;
+  }
 }
 
 namespace Benchmark
@@ -90,32 +115,47 @@ namespace Benchmark
       using namespace Devices::AYM;
       const Time::Timer timer;
       DataChunk chunk;
-      chunk.Data[Registers::MIXER] = Registers::MASK_TONEA | Registers::MASK_NOISEB | Registers::MASK_TONEC | Registers::MASK_NOISEC;
-      chunk.Data[Registers::VOLA] = 0;
-      chunk.Data[Registers::VOLB] = Registers::MASK_VOL;
-      chunk.Data[Registers::VOLC] = Registers::MASK_ENV | Registers::MASK_VOL;
+      InitChunk(chunk);
       dev.RenderData(chunk);
       const Stamp period = frameDuration;
       const uint_t frames = Stamp(duration).Get() / period.Get();
       for (uint_t val = 0; val != frames; ++val)
       {
-        const uint_t tonLo = (val &    0xff);
-        const uint_t tonHi = (val &   0xf00) >> 8;
-        const uint_t noise = (val & 0x1f000) >> 12;
-        const uint_t envLo = tonLo;
-        const uint_t envHi = (val &  0xff00) >> 8;
-        const uint_t envTp = (val & 0xf0000) >> 16;
-        chunk.Data[Registers::TONEA_L] = chunk.Data[Registers::TONEB_L] = chunk.Data[Registers::TONEC_L] = tonLo;
-        chunk.Data[Registers::TONEA_H] = chunk.Data[Registers::TONEB_H] = chunk.Data[Registers::TONEC_H] = tonHi;
-        chunk.Data[Registers::TONEN] = noise;
-        chunk.Data[Registers::TONEE_L] = envLo;
-        chunk.Data[Registers::TONEE_H] = envHi;
-        chunk.Data[Registers::ENV] = envTp;
+        FillChunk(val, chunk);
         chunk.TimeStamp += period;
         dev.RenderData(chunk);
       }
       const Stamp elapsed = timer.Elapsed();
       return double(chunk.TimeStamp.Get()) / elapsed.Get();
     }
+
+    double TestBlocks(Devices::AYM::Chip& dev, const Time::Milliseconds& duration, const Time::Microseconds& frameDuration, uint_t blockFrames, uint_t soundFreq)
+    {
+      using namespace Devices::AYM;
+      const Time::Timer timer;
+      DataChunk chunk;
+      InitChunk(chunk);
+      dev.RenderData(chunk);
+      const Stamp period = frameDuration;
+      const uint_t frames = Stamp(duration).Get() / period.Get();
+      std::vector<DataChunk> block;
+      block.reserve(blockFrames);
+      Sound::Chunk output;
+      output.reserve(uint64_t(soundFreq) * period.Get() * (blockFrames + 1) / Stamp::PER_SECOND);
+      for (uint_t val = 0; val != frames; ++val)
+      {
+        FillChunk(val, chunk);
+        chunk.TimeStamp += period;
+        block.push_back(chunk);
+        if (block.size() == blockFrames || val + 1 == frames)
+        {
+          output.clear();
+          dev.RenderBlock(&block.front(), &block.back() + 1, output);
+          block.clear();
+        }
+      }
+      const Stamp elapsed = timer.Elapsed();
+      return double(chunk.TimeStamp.Get()) / elapsed.Get();
+    }
   }
 }
@@ -20,5 +20,6 @@ namespace Benchmark
   {
     Devices::AYM::Chip::Ptr CreateDevice(uint64_t clockFreq, uint_t soundFreq, Devices::AYM::InterpolationType interpolate);
     double Test(Devices::AYM::Chip& dev, const Time::Milliseconds& duration, const Time::Microseconds& frameDuration);
+    double TestBlocks(Devices::AYM::Chip& dev, const Time::Milliseconds& duration, const Time::Microseconds& frameDuration, uint_t blockFrames, uint_t soundFreq);
   }
 }
@@ -11,6 +11,7 @@
 //local includes
 #include "benchmark.h"
 #include "ay.h"
+#include "filter.h"
 #include "z80.h"
 #include "mixer.h"
 //common includes
@@ -24,6 +25,7 @@ namespace Benchmark
   const unsigned SOUND_FREQ = 44100;
   const Time::Milliseconds FRAME_DURATION(20);
   const Time::Milliseconds TEST_DURATION(1000000);
+  const uint_t BLOCK_FRAMES = 50;
 
   namespace AY
   {
@@ -50,6 +52,8 @@ namespace Benchmark
           return "LQ interpolation";
         case Devices::AYM::INTERPOLATION_HQ:
           return "HQ interpolation";
+        case Devices::AYM::INTERPOLATION_HQ_CASCADED:
+          return "HQ interpolation (cascaded filter)";
         default:
           Require(false);
           return "Invalid interpolation";
@@ -61,15 +65,40 @@ namespace Benchmark
         const Devices::AYM::Chip::Ptr dev = CreateDevice(1750000, SOUND_FREQ, Interpolate);
         return Test(*dev, TEST_DURATION, FRAME_DURATION);
       }
-    private:
+    protected:
       const Devices::AYM::InterpolationType Interpolate;
     };
 
+    class BlockPerformanceTest : public PerformanceTest
+    {
+    public:
+      explicit BlockPerformanceTest(Devices::AYM::InterpolationType interpolate)
+        : PerformanceTest(interpolate)
+      {
+      }
+
+      std::string Category() const override
+      {
+        return (boost::format("AY chip emulation (%u frames blocks)") % BLOCK_FRAMES).str();
+      }
+
+      double Execute() const override
+      {
+        const Devices::AYM::Chip::Ptr dev = CreateDevice(1750000, SOUND_FREQ, Interpolate);
+        return TestBlocks(*dev, TEST_DURATION, FRAME_DURATION, BLOCK_FRAMES, SOUND_FREQ);
+      }
+    };
+
     void ForAllTests(TestsVisitor& visitor)
     {
       visitor.OnPerformanceTest(PerformanceTest(Devices::AYM::INTERPOLATION_NONE));
       visitor.OnPerformanceTest(PerformanceTest(Devices::AYM::INTERPOLATION_LQ));
       visitor.OnPerformanceTest(PerformanceTest(Devices::AYM::INTERPOLATION_HQ));
+      visitor.OnPerformanceTest(PerformanceTest(Devices::AYM::INTERPOLATION_HQ_CASCADED));
+      visitor.OnPerformanceTest(BlockPerformanceTest(Devices::AYM::INTERPOLATION_NONE));
+      visitor.OnPerformanceTest(BlockPerformanceTest(Devices::AYM::INTERPOLATION_LQ));
+      visitor.OnPerformanceTest(BlockPerformanceTest(Devices::AYM::INTERPOLATION_HQ));
+      visitor.OnPerformanceTest(BlockPerformanceTest(Devices::AYM::INTERPOLATION_HQ_CASCADED));
     }
   }
 
@@ -203,10 +232,98 @@ namespace Benchmark
     }
   }
 
+  namespace LPFilter
+  {
+    const uint64_t CLOCK_FREQ = 1750000;
+    const Time::Milliseconds FILTER_TEST_DURATION(100000);
+
+    std::string FilterName(bool cascaded)
+    {
+      return cascaded ? "4th order" : "2nd order";
+    }
+
+    class PerformanceTest : public Benchmark::PerformanceTest
+    {
+    public:
+      PerformanceTest(uint_t blockSize, bool cascaded)
+        : BlockSize(blockSize)
+        , Cascaded(cascaded)
+      {
+      }
+
+      std::string Category() const override
+      {
+        return "Low-pass filter";
+      }
+
+      std::string Name() const override
+      {
+        return BlockSize > 1
+          ? (boost::format("%s, %u samples blocks") % FilterName(Cascaded) % BlockSize).str()
+          : FilterName(Cascaded) + ", sample by sample";
+      }
+
+      double Execute() const override
+      {
+        return Test(CLOCK_FREQ, FILTER_TEST_DURATION, BlockSize, Cascaded);
+      }
+    private:
+      const uint_t BlockSize;
+      const bool Cascaded;
+    };
+
+    class ResponseTest : public Benchmark::QualityTest
+    {
+    public:
+      ResponseTest(uint_t toneFreq, bool cascaded)
+        : ToneFreq(toneFreq)
+        , Cascaded(cascaded)
+      {
+      }
+
+      std::string Category() const override
+      {
+        return "Low-pass filter (gain in dB)";
+      }
+
+      std::string Name() const override
+      {
+        return (boost::format("%s, %uHz") % FilterName(Cascaded) % ToneFreq).str();
+      }
+
+      double Execute() const override
+      {
+        return Response(CLOCK_FREQ, ToneFreq, Cascaded);
+      }
+    private:
+      const uint_t ToneFreq;
+      const bool Cascaded;
+    };
+
+    void ForAllTests(TestsVisitor& visitor)
+    {
+      for (const bool cascaded : {false, true})
+      {
+        visitor.OnPerformanceTest(PerformanceTest(1, cascaded));
+        visitor.OnPerformanceTest(PerformanceTest(64, cascaded));
+        visitor.OnPerformanceTest(PerformanceTest(1024, cascaded));
+      }
+      //passband, cutoff, aliased to audible range for 44100 output
+      for (const bool cascaded : {false, true})
+      {
+        for (const uint_t freq : {4000, 9500, 22050, 30000, 40000})
+        {
+          visitor.OnQualityTest(ResponseTest(freq, cascaded));
+        }
+      }
+    }
+  }
+
   void ForAllTests(TestsVisitor& visitor)
   {
     AY::ForAllTests(visitor);
     Z80::ForAllTests(visitor);
     Mixer::ForAllTests(visitor);
+    LPFilter::ForAllTests(visitor);
   }
 }
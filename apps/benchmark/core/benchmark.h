@@ -28,12 +28,24 @@ namespace Benchmark
     virtual double Execute() const = 0;
   };
 
+  class QualityTest
+  {
+  public:
+    virtual ~QualityTest() = default;
+
+    virtual std::string Category() const = 0;
+    virtual std::string Name() const = 0;
+    //! @return Measured value, units are specified by category
+    virtual double Execute() const = 0;
+  };
+
   class TestsVisitor
   {
   public:
     virtual ~TestsVisitor() = default;
 
     virtual void OnPerformanceTest(const PerformanceTest& test) = 0;
+    virtual void OnQualityTest(const QualityTest& test) = 0;
   };
 
   void ForAllTests(TestsVisitor& visitor);
@@ -0,0 +1,117 @@
+/**
+* 
+* @file
+*
+* @brief  Low-pass filter test implementation
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+//local includes
+#include "filter.h"
+//library includes
+#include <sound/lpfilter.h>
+#include <time/timer.h>
+//std includes
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+  //prevent optimizing out of the whole test
+  volatile Sound::Sample::WideType Output;
+
+  //square waves of different periods on channels, as chips generate
+  std::vector<Sound::Sample> CreateInput(std::size_t size)
+  {
+    std::vector<Sound::Sample> result(size);
+    for (std::size_t idx = 0; idx != size; ++idx)
+    {
+      const Sound::Sample::Type left = (idx & 64) ? Sound::Sample::MAX / 2 : Sound::Sample::MIN / 2;
+      const Sound::Sample::Type right = (idx & 100) ? Sound::Sample::MAX / 3 : Sound::Sample::MID;
+      result[idx] = Sound::Sample(left, right);
+    }
+    return result;
+  }
+
+  template<class FilterType>
+  double TestFilter(uint64_t sampleFreq, const Time::Milliseconds& duration, uint_t blockSize)
+  {
+    const std::vector<Sound::Sample> input = CreateInput(4096);
+    FilterType filter;
+    filter.SetParameters(sampleFreq, 9500);
+    const uint64_t totalSamples = sampleFreq * duration.Get() / duration.PER_SECOND;
+    const Time::Timer timer;
+    for (uint64_t done = 0; done < totalSamples; done += input.size())
+    {
+      if (blockSize > 1)
+      {
+        for (std::size_t pos = 0; pos < input.size(); pos += blockSize)
+        {
+          filter.Feed(&input[pos], std::min<std::size_t>(blockSize, input.size() - pos));
+        }
+      }
+      else
+      {
+        for (const auto& in : input)
+        {
+          filter.Feed(in);
+        }
+      }
+      Output = filter.Get().Left();
+    }
+    const Time::Nanoseconds elapsed = timer.Elapsed();
+    const Time::Nanoseconds emulated(duration);
+    return double(emulated.Get()) / elapsed.Get();
+  }
+
+  template<class FilterType>
+  double MeasureResponse(uint64_t sampleFreq, uint_t toneFreq)
+  {
+    const double AMPLITUDE = Sound::Sample::MAX / 2;
+    const double PI = 3.14159265358;
+    FilterType filter;
+    filter.SetParameters(sampleFreq, 9500);
+    //skip transient process
+    const uint64_t settle = sampleFreq / 50;
+    const uint64_t total = settle + sampleFreq / 10;
+    double inPower = 0;
+    double outPower = 0;
+    for (uint64_t idx = 0; idx != total; ++idx)
+    {
+      const double in = AMPLITUDE * std::sin(2 * PI * toneFreq * idx / sampleFreq);
+      const Sound::Sample::Type val = static_cast<Sound::Sample::Type>(in);
+      filter.Feed(Sound::Sample(val, val));
+      if (idx >= settle)
+      {
+        const double out = filter.Get().Left();
+        inPower += double(val) * val;
+        outPower += out * out;
+      }
+    }
+    //value for full suppression is limited by rounding noise anyway
+    return 10 * std::log10(std::max(outPower, 1.0) / inPower);
+  }
+}
+
+namespace Benchmark
+{
+  namespace LPFilter
+  {
+    double Test(uint64_t sampleFreq, const Time::Milliseconds& duration, uint_t blockSize, bool cascaded)
+    {
+      return cascaded
+        ? TestFilter<Sound::CascadedLPFilter>(sampleFreq, duration, blockSize)
+        : TestFilter<Sound::LPFilter>(sampleFreq, duration, blockSize);
+    }
+
+    double Response(uint64_t sampleFreq, uint_t toneFreq, bool cascaded)
+    {
+      return cascaded
+        ? MeasureResponse<Sound::CascadedLPFilter>(sampleFreq, toneFreq)
+        : MeasureResponse<Sound::LPFilter>(sampleFreq, toneFreq);
+    }
+  }
+}
@@ -0,0 +1,25 @@
+/**
+* 
+* @file
+*
+* @brief  Low-pass filter test interface
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+#pragma once
+
+//library includes
+#include <time/stamp.h>
+
+namespace Benchmark
+{
+  namespace LPFilter
+  {
+    double Test(uint64_t sampleFreq, const Time::Milliseconds& duration, uint_t blockSize, bool cascaded);
+
+    //! @return Gain for sine tone of specified frequency in dB
+    double Response(uint64_t sampleFreq, uint_t toneFreq, bool cascaded);
+  }
+}
@@ -0,0 +1,62 @@
+/**
+*
+* @file
+*
+* @brief  Dynamic memory allocations tracking implementation
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+//local includes
+#include "allocations.h"
+//std includes
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+  std::atomic<uint64_t> AllocationsCount(0);
+
+  void* Allocate(std::size_t size)
+  {
+    AllocationsCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* const res = std::malloc(size ? size : 1))
+    {
+      return res;
+    }
+    throw std::bad_alloc();
+  }
+}
+
+void* operator new(std::size_t size)
+{
+  return Allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+  return Allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+namespace Benchmark
+{
+  namespace Allocations
+  {
+    uint64_t GetCount()
+    {
+      return AllocationsCount.load(std::memory_order_relaxed);
+    }
+  }
+}
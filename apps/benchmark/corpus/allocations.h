@@ -0,0 +1,24 @@
+/**
+*
+* @file
+*
+* @brief  Dynamic memory allocations tracking interface
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+#pragma once
+
+//common includes
+#include <types.h>
+
+namespace Benchmark
+{
+  namespace Allocations
+  {
+    //! @return Count of dynamic memory allocations made via operator new since program start
+    //! @note Tracking is enabled by linking in global operators new/delete replacement
+    uint64_t GetCount();
+  }
+}
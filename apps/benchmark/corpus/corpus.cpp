@@ -0,0 +1,90 @@
+/**
+*
+* @file
+*
+* @brief  Corpus-based benchmarks common code implementation
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+//local includes
+#include "corpus.h"
+//common includes
+#include <progress_callback.h>
+//library includes
+#include <io/api.h>
+#include <parameters/container.h>
+//std includes
+#include <algorithm>
+//boost includes
+#include <boost/filesystem/operations.hpp>
+#include <boost/filesystem/path.hpp>
+//platform-specific includes
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace Benchmark
+{
+  namespace Corpus
+  {
+    Strings::Array EnumerateFiles(const Strings::Array& paths)
+    {
+      Strings::Array result;
+      for (const auto& path : paths)
+      {
+        const boost::filesystem::path root(path);
+        if (boost::filesystem::is_directory(root))
+        {
+          for (boost::filesystem::recursive_directory_iterator it(root), lim; it != lim; ++it)
+          {
+            if (boost::filesystem::is_regular_file(it->status()))
+            {
+              result.push_back(it->path().string());
+            }
+          }
+        }
+        else
+        {
+          result.push_back(path);
+        }
+      }
+      std::sort(result.begin(), result.end());
+      result.erase(std::unique(result.begin(), result.end()), result.end());
+      return result;
+    }
+
+    Binary::Container::Ptr OpenFile(const String& path)
+    {
+      const auto emptyParams = Parameters::Container::Create();
+      return IO::OpenData(path, *emptyParams, Log::ProgressCallback::Stub());
+    }
+
+    uint64_t GetPeakMemoryUsage()
+    {
+#if defined(__linux__) || defined(__APPLE__)
+      ::rusage usage;
+      if (0 != ::getrusage(RUSAGE_SELF, &usage))
+      {
+        return 0;
+      }
+#  if defined(__APPLE__)
+      return usage.ru_maxrss;
+#  else
+      //kilobytes
+      return uint64_t(usage.ru_maxrss) * 1024;
+#  endif
+#else
+      return 0;
+#endif
+    }
+
+    double GetThroughput(uint64_t bytes, const Time::Microseconds& elapsed)
+    {
+      return elapsed.Get()
+        ? double(bytes) / elapsed.Get()
+        : 0.0;
+    }
+  }
+}
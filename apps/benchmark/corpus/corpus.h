@@ -0,0 +1,37 @@
+/**
+*
+* @file
+*
+* @brief  Corpus-based benchmarks common code
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+#pragma once
+
+//common includes
+#include <types.h>
+//library includes
+#include <binary/container.h>
+#include <strings/array.h>
+#include <time/stamp.h>
+
+namespace Benchmark
+{
+  namespace Corpus
+  {
+    //! @brief Lists all the regular files at specified paths recursively in stable order
+    Strings::Array EnumerateFiles(const Strings::Array& paths);
+
+    //! @brief Reads whole file into memory
+    //! @throw Error in case of failure
+    Binary::Container::Ptr OpenFile(const String& path);
+
+    //! @return Peak resident memory size of the process in bytes or 0 if unsupported
+    uint64_t GetPeakMemoryUsage();
+
+    //! @return Amount of data processed per second in megabytes
+    double GetThroughput(uint64_t bytes, const Time::Microseconds& elapsed);
+  }
+}
@@ -0,0 +1,204 @@
+/**
+*
+* @file
+*
+* @brief  Modules detection benchmark implementation
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+//local includes
+#include "detection.h"
+#include "corpus.h"
+//common includes
+#include <error.h>
+//library includes
+#include <core/module_detect.h>
+#include <core/plugins/archive_plugins_enumerator.h>
+#include <core/plugins/player_plugins_enumerator.h>
+#include <parameters/container.h>
+#include <time/timer.h>
+//std includes
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <utility>
+
+namespace
+{
+  class CountingDetectCallback : public Module::DetectCallback
+  {
+  public:
+    CountingDetectCallback()
+      : Modules()
+    {
+    }
+
+    void ProcessModule(ZXTune::DataLocation::Ptr /*location*/, ZXTune::Plugin::Ptr /*decoder*/, Module::Holder::Ptr /*holder*/) const override
+    {
+      ++Modules;
+    }
+
+    Log::ProgressCallback* GetProgress() const override
+    {
+      return nullptr;
+    }
+
+    uint_t GetModulesCount() const
+    {
+      return Modules;
+    }
+  private:
+    mutable uint_t Modules;
+  };
+
+  struct TotalStatistic
+  {
+    uint_t Files;
+    uint_t Failed;
+    uint64_t Bytes;
+    uint_t Modules;
+    Time::Microseconds Elapsed;
+
+    TotalStatistic()
+      : Files()
+      , Failed()
+      , Bytes()
+      , Modules()
+    {
+    }
+  };
+
+  struct PluginStatistic
+  {
+    uint_t Probes;
+    Time::Microseconds ProbesTime;
+    uint_t Hits;
+    Time::Microseconds HitsTime;
+    uint_t FormatMatches;
+    uint_t FalseProbes;
+
+    PluginStatistic()
+      : Probes()
+      , Hits()
+      , FormatMatches()
+      , FalseProbes()
+    {
+    }
+  };
+
+  class Statistic
+  {
+  public:
+    void DetectAll(const Parameters::Accessor& params, Binary::Container::Ptr data)
+    {
+      const CountingDetectCallback callback;
+      const Time::Timer timer;
+      Module::Detect(params, data, callback);
+      Totals.Elapsed += timer.Elapsed();
+      ++Totals.Files;
+      Totals.Bytes += data->Size();
+      Totals.Modules += callback.GetModulesCount();
+    }
+
+    void AddFailed()
+    {
+      ++Totals.Failed;
+    }
+
+    template<class PluginType>
+    void ProbeAll(const String& type, const Parameters::Accessor& params, Binary::Container::Ptr data)
+    {
+      for (const auto plugins = ZXTune::PluginsEnumerator<PluginType>::Create()->Enumerate(); plugins->IsValid(); plugins->Next())
+      {
+        const auto plugin = plugins->Get();
+        Probe(*plugin, params, data, Plugins[PluginKey(type, plugin->GetDescription()->Id())]);
+      }
+    }
+
+    void Report(std::ostream& str) const
+    {
+      str << std::fixed << std::setprecision(6);
+      str << "files\tfailed\tbytes\tmodules\tseconds\tmb_per_second\tpeak_memory_kb\n"
+          << Totals.Files << '\t' << Totals.Failed << '\t' << Totals.Bytes << '\t' << Totals.Modules << '\t'
+          << GetSeconds(Totals.Elapsed) << '\t' << Benchmark::Corpus::GetThroughput(Totals.Bytes, Totals.Elapsed) << '\t'
+          << Benchmark::Corpus::GetPeakMemoryUsage() / 1024 << "\n\n";
+      str << "type\tplugin\tprobes\tprobes_seconds\thits\thits_seconds\tformat_matches\tfalse_probes\tfalse_probes_ratio\n";
+      for (const auto& plugin : Plugins)
+      {
+        const PluginStatistic& stat = plugin.second;
+        str << plugin.first.first << '\t' << plugin.first.second << '\t' << stat.Probes << '\t' << GetSeconds(stat.ProbesTime) << '\t'
+            << stat.Hits << '\t' << GetSeconds(stat.HitsTime) << '\t'
+            << stat.FormatMatches << '\t' << stat.FalseProbes << '\t'
+            << (stat.FormatMatches ? double(stat.FalseProbes) / stat.FormatMatches : 0.0) << '\n';
+      }
+      str << std::flush;
+    }
+  private:
+    template<class PluginType>
+    static void Probe(const PluginType& plugin, const Parameters::Accessor& params, Binary::Container::Ptr data, PluginStatistic& stat)
+    {
+      const CountingDetectCallback callback;
+      const auto format = plugin.GetFormat();
+      const bool formatMatched = format && format->Match(*data);
+      const Time::Timer timer;
+      const auto result = plugin.Detect(params, ZXTune::CreateLocation(data), callback);
+      const Time::Microseconds elapsed = timer.Elapsed();
+      ++stat.Probes;
+      stat.ProbesTime += elapsed;
+      const bool detected = 0 != result->GetMatchedDataSize();
+      if (detected)
+      {
+        ++stat.Hits;
+        stat.HitsTime += elapsed;
+      }
+      if (formatMatched)
+      {
+        ++stat.FormatMatches;
+        if (!detected)
+        {
+          ++stat.FalseProbes;
+        }
+      }
+    }
+
+    static double GetSeconds(const Time::Microseconds& time)
+    {
+      return double(time.Get()) / Time::Microseconds::PER_SECOND;
+    }
+  private:
+    TotalStatistic Totals;
+    //archive and player plugins may share the same id
+    typedef std::pair<String, String> PluginKey;
+    std::map<PluginKey, PluginStatistic> Plugins;
+  };
+}
+
+namespace Benchmark
+{
+  namespace Detection
+  {
+    void Run(const Strings::Array& files, std::ostream& report)
+    {
+      const auto params = Parameters::Container::Create();
+      Statistic stat;
+      for (const auto& file : files)
+      {
+        try
+        {
+          const auto data = Corpus::OpenFile(file);
+          stat.DetectAll(*params, data);
+          stat.ProbeAll<ZXTune::ArchivePlugin>("archive", *params, data);
+          stat.ProbeAll<ZXTune::PlayerPlugin>("player", *params, data);
+        }
+        catch (const Error& e)
+        {
+          std::cerr << file << ": " << e.GetText() << std::endl;
+          stat.AddFailed();
+        }
+      }
+      stat.Report(report);
+    }
+  }
+}
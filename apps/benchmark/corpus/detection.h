@@ -0,0 +1,31 @@
+/**
+*
+* @file
+*
+* @brief  Modules detection benchmark interface
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+#pragma once
+
+//library includes
+#include <strings/array.h>
+//std includes
+#include <ostream>
+
+namespace Benchmark
+{
+  namespace Detection
+  {
+    /*
+      Measures full recursive detection over each file, then probes every archive and player plugin
+      at the start of each file. Report is written as tab-separated tables:
+        - totals: files, bytes, found modules, time, throughput and peak memory
+        - per plugin: probes count and time, hits count and time, false probes ratio.
+          False probe is a successful format check with failed detection afterwards.
+    */
+    void Run(const Strings::Array& files, std::ostream& report);
+  }
+}
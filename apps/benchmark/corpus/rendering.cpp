@@ -0,0 +1,199 @@
+/**
+*
+* @file
+*
+* @brief  Modules rendering benchmark implementation
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+//local includes
+#include "rendering.h"
+#include "allocations.h"
+#include "corpus.h"
+//common includes
+#include <error.h>
+//library includes
+#include <core/core_parameters.h>
+#include <core/module_detect.h>
+#include <module/attributes.h>
+#include <parameters/container.h>
+#include <parameters/merged_accessor.h>
+#include <sound/sound_parameters.h>
+#include <time/timer.h>
+//std includes
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <vector>
+
+namespace
+{
+  //sound time rendered for each module in each mode
+  const Time::Milliseconds RENDER_DURATION(60000);
+
+  struct InterpolationMode
+  {
+    const char* Name;
+    Parameters::IntType AYM;
+    Parameters::IntType DAC;
+    Parameters::IntType SAA;
+    Parameters::IntType SID;
+  };
+
+  namespace Core = Parameters::ZXTune::Core;
+
+  const InterpolationMode MODES[] =
+  {
+    {"none", Core::AYM::INTERPOLATION_NONE, Core::DAC::INTERPOLATION_NO, Core::SAA::INTERPOLATION_NONE, Core::SID::INTERPOLATION_NONE},
+    {"lq", Core::AYM::INTERPOLATION_LQ, Core::DAC::INTERPOLATION_YES, Core::SAA::INTERPOLATION_LQ, Core::SID::INTERPOLATION_LQ},
+    {"hq", Core::AYM::INTERPOLATION_HQ, Core::DAC::INTERPOLATION_YES, Core::SAA::INTERPOLATION_HQ, Core::SID::INTERPOLATION_HQ},
+  };
+
+  Parameters::Accessor::Ptr CreateParameters(const InterpolationMode& mode)
+  {
+    const auto params = Parameters::Container::Create();
+    params->SetValue(Core::AYM::INTERPOLATION, mode.AYM);
+    params->SetValue(Core::DAC::INTERPOLATION, mode.DAC);
+    params->SetValue(Core::SAA::INTERPOLATION, mode.SAA);
+    params->SetValue(Core::SID::INTERPOLATION, mode.SID);
+    params->SetValue(Parameters::ZXTune::Sound::LOOPED, 1);
+    return params;
+  }
+
+  class CollectModulesCallback : public Module::DetectCallback
+  {
+  public:
+    void ProcessModule(ZXTune::DataLocation::Ptr /*location*/, ZXTune::Plugin::Ptr /*decoder*/, Module::Holder::Ptr holder) const override
+    {
+      Modules.push_back(holder);
+    }
+
+    Log::ProgressCallback* GetProgress() const override
+    {
+      return nullptr;
+    }
+
+    const std::vector<Module::Holder::Ptr>& GetModules() const
+    {
+      return Modules;
+    }
+  private:
+    mutable std::vector<Module::Holder::Ptr> Modules;
+  };
+
+  struct ModeStatistic
+  {
+    uint_t Modules;
+    Time::Microseconds SoundTime;
+    Time::Microseconds Elapsed;
+    uint64_t Allocations;
+
+    ModeStatistic()
+      : Modules()
+      , Allocations()
+    {
+    }
+  };
+
+  class Statistic
+  {
+  public:
+    void Render(const Module::Holder& holder)
+    {
+      const auto props = holder.GetModuleProperties();
+      String type;
+      props->FindValue(Module::ATTR_TYPE, type);
+      for (const auto& mode : MODES)
+      {
+        const auto params = Parameters::CreateMergedAccessor(props, CreateParameters(mode));
+        Render(holder, params, Types[type][mode.Name]);
+      }
+    }
+
+    void Report(std::ostream& str) const
+    {
+      str << std::fixed << std::setprecision(3);
+      str << "type\tinterpolation\tmodules\tsound_seconds\tseconds\trealtime_factor\tallocations_per_second\n";
+      for (const auto& type : Types)
+      {
+        for (const auto& mode : MODES)
+        {
+          const auto it = type.second.find(mode.Name);
+          if (it == type.second.end())
+          {
+            continue;
+          }
+          const ModeStatistic& stat = it->second;
+          const double soundSeconds = GetSeconds(stat.SoundTime);
+          str << type.first << '\t' << mode.Name << '\t' << stat.Modules << '\t'
+              << soundSeconds << '\t' << GetSeconds(stat.Elapsed) << '\t'
+              << (stat.Elapsed.Get() ? double(stat.SoundTime.Get()) / stat.Elapsed.Get() : 0.0) << '\t'
+              << (stat.SoundTime.Get() ? stat.Allocations / soundSeconds : 0.0) << '\n';
+        }
+      }
+      str << std::flush;
+    }
+  private:
+    static void Render(const Module::Holder& holder, Parameters::Accessor::Ptr params, ModeStatistic& stat)
+    {
+      Parameters::IntType frameDuration = Parameters::ZXTune::Sound::FRAMEDURATION_DEFAULT;
+      params->FindValue(Parameters::ZXTune::Sound::FRAMEDURATION, frameDuration);
+      const Time::Microseconds period(frameDuration);
+      const auto frames = Time::Microseconds(RENDER_DURATION).Get() / period.Get();
+      const auto renderer = holder.CreateRenderer(params, Sound::Receiver::CreateStub());
+      const auto allocationsBefore = Benchmark::Allocations::GetCount();
+      const Time::Timer timer;
+      uint64_t rendered = 0;
+      while (rendered < frames)
+      {
+        ++rendered;
+        if (!renderer->RenderFrame())
+        {
+          break;
+        }
+      }
+      stat.Elapsed += timer.Elapsed();
+      stat.Allocations += Benchmark::Allocations::GetCount() - allocationsBefore;
+      stat.SoundTime += Time::Microseconds(rendered * period.Get());
+      ++stat.Modules;
+    }
+
+    static double GetSeconds(const Time::Microseconds& time)
+    {
+      return double(time.Get()) / Time::Microseconds::PER_SECOND;
+    }
+  private:
+    std::map<String, std::map<String, ModeStatistic> > Types;
+  };
+}
+
+namespace Benchmark
+{
+  namespace Rendering
+  {
+    void Run(const Strings::Array& files, std::ostream& report)
+    {
+      const auto params = Parameters::Container::Create();
+      Statistic stat;
+      for (const auto& file : files)
+      {
+        try
+        {
+          const CollectModulesCallback callback;
+          Module::Detect(*params, Corpus::OpenFile(file), callback);
+          for (const auto& holder : callback.GetModules())
+          {
+            stat.Render(*holder);
+          }
+        }
+        catch (const Error& e)
+        {
+          std::cerr << file << ": " << e.GetText() << std::endl;
+        }
+      }
+      stat.Report(report);
+    }
+  }
+}
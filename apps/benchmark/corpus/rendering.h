@@ -0,0 +1,29 @@
+/**
+*
+* @file
+*
+* @brief  Modules rendering benchmark interface
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+#pragma once
+
+//library includes
+#include <strings/array.h>
+//std includes
+#include <ostream>
+
+namespace Benchmark
+{
+  namespace Rendering
+  {
+    /*
+      Renders every module found in files for fixed looped duration with each interpolation mode
+      (applied to all the chips supporting it). Report is written as tab-separated table
+      with modules count, realtime factor and allocations per second of sound for each module type and mode.
+    */
+    void Run(const Strings::Array& files, std::ostream& report);
+  }
+}
@@ -9,6 +9,9 @@
 **/
 
 #include "core/benchmark.h"
+#include "corpus/corpus.h"
+#include "corpus/detection.h"
+#include "corpus/rendering.h"
 #include <iostream>
 
 namespace
@@ -26,13 +29,47 @@ namespace
       }
       std::cout << " " << test.Name() << ": " << std::flush << 'x' << test.Execute() << std::endl;
     }
+
+    void OnQualityTest(const Benchmark::QualityTest& test) override
+    {
+      const std::string cat = test.Category();
+      if (cat != LastCategory)
+      {
+        std::cout << "Quality of " << cat << std::endl;
+        LastCategory = cat;
+      }
+      std::cout << " " << test.Name() << ": " << std::flush << test.Execute() << std::endl;
+    }
   private:
     std::string LastCategory;
   };
 }
 
-int main()
+int main(int argc, char* argv[])
 {
-  ExecuteTestsVisitor visitor;
-  Benchmark::ForAllTests(visitor);
+  const std::string mode = argc > 1 ? argv[1] : "";
+  if (mode.empty())
+  {
+    ExecuteTestsVisitor visitor;
+    Benchmark::ForAllTests(visitor);
+  }
+  else if (mode == "--detect" && argc > 2)
+  {
+    const Strings::Array files = Benchmark::Corpus::EnumerateFiles(Strings::Array(argv + 2, argv + argc));
+    Benchmark::Detection::Run(files, std::cout);
+  }
+  else if (mode == "--render" && argc > 2)
+  {
+    const Strings::Array files = Benchmark::Corpus::EnumerateFiles(Strings::Array(argv + 2, argv + argc));
+    Benchmark::Rendering::Run(files, std::cout);
+  }
+  else
+  {
+    std::cout << "Usage:\n"
+      << " " << argv[0] << "                              synthetic emulation tests\n"
+      << " " << argv[0] << " --detect <files or folders>  modules detection over corpus\n"
+      << " " << argv[0] << " --render <files or folders>  modules rendering over corpus\n";
+    return 1;
+  }
+  return 0;
 }
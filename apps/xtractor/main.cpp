@@ -12,11 +12,13 @@
 //common includes
 #include <progress_callback.h>
 #include <make_ptr.h>
+#include <pointers.h>
 //library includes
 #include <analysis/path.h>
 #include <analysis/result.h>
 #include <analysis/scanner.h>
 #include <async/data_receiver.h>
+#include <binary/container_factories.h>
 #include <binary/format_factories.h>
 #include <debug/log.h>
 #include <formats/archived/decoders.h>
@@ -26,6 +28,7 @@
 #include <io/api.h>
 #include <io/providers_parameters.h>
 #include <io/impl/boost_filesystem_path.h>
+#include <io/providers/file_provider.h>
 #include <parameters/container.h>
 #include <platform/application.h>
 #include <platform/version/api.h>
@@ -34,19 +37,27 @@
 #include <strings/format.h>
 #include <strings/template.h>
 //std includes
+#include <array>
+#include <condition_variable>
 #include <iostream>
 #include <locale>
 #include <map>
+#include <mutex>
 #include <numeric>
 #include <set>
 //boost includes
 #include <boost/bind.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
 #include <boost/program_options.hpp>
 #include <boost/algorithm/string/join.hpp>
+//3rdparty includes
+#include <3rdparty/lzma/C/Sha256.h>
 //text includes
 #include "text/text.h"
 
+#define FILE_TAG 5A1C3E27
+
 namespace
 {
   const Debug::Stream Dbg("XTractor");
@@ -70,7 +81,7 @@ namespace Analysis
 
   Node::Ptr CreateRootNode(Binary::Container::Ptr data, const String& name);
   Node::Ptr CreateSubnode(Node::Ptr parent, Binary::Container::Ptr data, const String& name);
-  Node::Ptr CreateSubnode(Node::Ptr parent, Binary::Container::Ptr data, std::size_t offset);
+  Node::Ptr CreateSubnode(Node::Ptr parent, Binary::Container::Ptr data, uint64_t offset);
 }
 
 namespace
@@ -103,6 +114,40 @@ namespace
     const String NameVal;
   };
 
+  //Part of root data scanned separately
+  class WindowNode : public RootNode
+  {
+  public:
+    WindowNode(Binary::Container::Ptr data, String name, uint64_t base, std::size_t reportFrom, std::size_t reportTill)
+      : RootNode(std::move(data), std::move(name))
+      , BaseVal(base)
+      , ReportFromVal(reportFrom)
+      , ReportTillVal(reportTill)
+    {
+    }
+
+    //! Offset of window in root data
+    uint64_t Base() const
+    {
+      return BaseVal;
+    }
+
+    //! Range of offsets in window to report found data from
+    std::size_t ReportFrom() const
+    {
+      return ReportFromVal;
+    }
+
+    std::size_t ReportTill() const
+    {
+      return ReportTillVal;
+    }
+  private:
+    const uint64_t BaseVal;
+    const std::size_t ReportFromVal;
+    const std::size_t ReportTillVal;
+  };
+
   class SubNode : public Analysis::Node
   {
   public:
@@ -147,12 +192,12 @@ namespace Analysis
     return MakePtr<SubNode>(std::move(parent), std::move(data), name);
   }
 
-  Node::Ptr CreateSubnode(Node::Ptr parent, Binary::Container::Ptr data, std::size_t offset)
+  Node::Ptr CreateSubnode(Node::Ptr parent, Binary::Container::Ptr data, uint64_t offset)
   {
     return MakePtr<SubNode>(std::move(parent), std::move(data), Strings::Format("+%1%", offset));
   }
 
-  Node::Ptr CreateSubnode(Node::Ptr parent, Binary::Container::Ptr data, const String& name, std::size_t offset)
+  Node::Ptr CreateSubnode(Node::Ptr parent, Binary::Container::Ptr data, const String& name, uint64_t offset)
   {
     auto intermediate = CreateSubnode(parent, data, offset);
     return CreateSubnode(std::move(intermediate), std::move(data), name);
@@ -345,23 +390,74 @@ namespace Parsing
 
 namespace
 {
+  class FilesStorage : private IO::FileCreatingParameters
+  {
+  public:
+    typedef std::shared_ptr<FilesStorage> Ptr;
+
+    //! @return path of really stored file
+    String Save(const Parsing::Result& result)
+    {
+      String filePath;
+      const Binary::OutputStream::Ptr target = Create(result.Name(), filePath);
+      const Binary::Container::Ptr data = result.Data();
+      target->ApplyData(*data);
+      return filePath;
+    }
+
+    //! @return path of really created link
+    String Link(const String& original, const String& name)
+    {
+      //same names policy as for regular files
+      const std::lock_guard<std::mutex> lock(Guard);
+      const String linkPath = IO::ResolveLocalFilePath(name, *this);
+      boost::filesystem::create_hard_link(IO::Details::FromString(original), IO::Details::FromString(linkPath));
+      return linkPath;
+    }
+  private:
+    Binary::OutputStream::Ptr Create(const String& name, String& filePath)
+    {
+      //renaming decision and file creation should be atomic for concurrent savers
+      const std::lock_guard<std::mutex> lock(Guard);
+      return IO::CreateLocalFile(name, *this, filePath);
+    }
+
+    IO::OverwriteMode Overwrite() const override
+    {
+      return IO::RENAME_NEW;
+    }
+
+    bool CreateDirectories() const override
+    {
+      return true;
+    }
+
+    bool SanitizeNames() const override
+    {
+      return true;
+    }
+
+    std::size_t WriteBufferSize() const override
+    {
+      return static_cast<std::size_t>(Parameters::ZXTune::IO::Providers::File::WRITE_BUFFER_SIZE_DEFAULT);
+    }
+  private:
+    std::mutex Guard;
+  };
+
   class SaveTarget : public Parsing::Target
   {
   public:
-    SaveTarget()
-      : Params(Parameters::Container::Create())
+    explicit SaveTarget(FilesStorage::Ptr storage)
+      : Storage(std::move(storage))
     {
-      Params->SetValue(Parameters::ZXTune::IO::Providers::File::OVERWRITE_EXISTING, 2);
     }
 
     void ApplyData(Parsing::Result::Ptr result) override
     {
       try
       {
-        const String filePath = result->Name();
-        const Binary::OutputStream::Ptr target = IO::CreateStream(filePath, *Params, Log::ProgressCallback::Stub());
-        const Binary::Container::Ptr data = result->Data();
-        target->ApplyData(*data);
+        Storage->Save(*result);
       }
       catch (const Error& e)
       {
@@ -373,7 +469,7 @@ namespace
     {
     }
   private:
-    const Parameters::Container::Ptr Params;
+    const FilesStorage::Ptr Storage;
   };
 
   class StatisticTarget : public Parsing::Target
@@ -401,11 +497,211 @@ namespace
   };
 }
 
+namespace
+{
+  enum DuplicatesMode
+  {
+    KEEP_DUPLICATES,
+    SKIP_DUPLICATES,
+    LINK_DUPLICATES
+  };
+
+  class DataKey
+  {
+  public:
+    explicit DataKey(const Binary::Data& data)
+      : Size(data.Size())
+    {
+      CSha256 ctx;
+      ::Sha256_Init(&ctx);
+      ::Sha256_Update(&ctx, static_cast<const Byte*>(data.Start()), Size);
+      ::Sha256_Final(&ctx, Digest.data());
+    }
+
+    bool operator < (const DataKey& rh) const
+    {
+      return Size == rh.Size
+        ? Digest < rh.Digest
+        : Size < rh.Size;
+    }
+
+    std::size_t GetSize() const
+    {
+      return Size;
+    }
+  private:
+    std::size_t Size;
+    std::array<uint8_t, SHA256_DIGEST_SIZE> Digest;
+  };
+
+  class DeduplicateTarget : public Parsing::Target
+  {
+  public:
+    //! @param storage is used to save originals and link duplicates to them, delegate is used otherwise
+    DeduplicateTarget(Parsing::Target::Ptr delegate, FilesStorage::Ptr storage)
+      : Delegate(std::move(delegate))
+      , Storage(std::move(storage))
+      , Total(0)
+      , TotalSize(0)
+    {
+    }
+
+    void ApplyData(Parsing::Result::Ptr result) override
+    {
+      const DataKey key(*result->Data());
+      std::unique_lock<std::mutex> lock(Guard);
+      const auto inserted = Index.emplace(key, Entry());
+      Entry& entry = inserted.first->second;
+      if (inserted.second)
+      {
+        lock.unlock();
+        Store(std::move(result), entry);
+      }
+      else if (!Storage)
+      {
+        ++Total;
+        TotalSize += key.GetSize();
+      }
+      else
+      {
+        //first copy may still be stored in another thread
+        Stored.wait(lock, [&entry]() {return entry.Stored;});
+        if (entry.Path.empty())
+        {
+          //nothing to link to, so this copy becomes an original
+          entry.Stored = false;
+          lock.unlock();
+          Store(std::move(result), entry);
+          return;
+        }
+        const String original = entry.Path;
+        lock.unlock();
+        if (Link(original, result->Name()))
+        {
+          const std::lock_guard<std::mutex> statLock(Guard);
+          ++Total;
+          TotalSize += key.GetSize();
+        }
+        else
+        {
+          Save(*result);
+        }
+      }
+    }
+
+    void Flush() override
+    {
+      Delegate->Flush();
+      std::cout << Strings::Format(Text::DUPLICATES_OUTPUT, Total, TotalSize) << std::endl;
+    }
+  private:
+    struct Entry
+    {
+      Entry()
+        : Stored(false)
+      {
+      }
+
+      //empty if failed to store
+      String Path;
+      bool Stored;
+    };
+
+    class StoreGuard
+    {
+    public:
+      StoreGuard(DeduplicateTarget& self, Entry& entry)
+        : Self(self)
+        , Object(entry)
+      {
+      }
+
+      //wake up waiters even if storing failed
+      ~StoreGuard()
+      {
+        {
+          const std::lock_guard<std::mutex> lock(Self.Guard);
+          Object.Path = std::move(Path);
+          Object.Stored = true;
+        }
+        Self.Stored.notify_all();
+      }
+
+      String Path;
+    private:
+      DeduplicateTarget& Self;
+      Entry& Object;
+    };
+
+    void Store(Parsing::Result::Ptr result, Entry& entry)
+    {
+      StoreGuard guard(*this, entry);
+      if (!Storage)
+      {
+        Delegate->ApplyData(std::move(result));
+        return;
+      }
+      guard.Path = Save(*result);
+    }
+
+    //! @return empty string in case of error
+    String Save(const Parsing::Result& result)
+    {
+      try
+      {
+        return Storage->Save(result);
+      }
+      catch (const Error& e)
+      {
+        std::cout << e.ToString();
+        return String();
+      }
+    }
+
+    //! @return false if duplicate is not linked, so it should be saved as is
+    bool Link(const String& original, const String& duplicate)
+    {
+      try
+      {
+        Storage->Link(original, duplicate);
+        return true;
+      }
+      catch (const Error& e)
+      {
+        std::cout << Strings::Format(Text::LINK_FAILED, duplicate, original, e.ToString());
+      }
+      catch (const std::exception& e)
+      {
+        std::cout << Strings::Format(Text::LINK_FAILED, duplicate, original, e.what());
+      }
+      return false;
+    }
+  private:
+    const Parsing::Target::Ptr Delegate;
+    const FilesStorage::Ptr Storage;
+    std::mutex Guard;
+    std::condition_variable Stored;
+    std::map<DataKey, Entry> Index;
+    std::size_t Total;
+    uint64_t TotalSize;
+  };
+}
+
 namespace Parsing
 {
-  Parsing::Target::Ptr CreateSaveTarget()
+  Parsing::Target::Ptr CreateDeduplicateTarget(Parsing::Target::Ptr target)
+  {
+    return MakePtr<DeduplicateTarget>(std::move(target), FilesStorage::Ptr());
+  }
+
+  Parsing::Target::Ptr CreateLinkDuplicatesTarget(Parsing::Target::Ptr target, FilesStorage::Ptr storage)
+  {
+    return MakePtr<DeduplicateTarget>(std::move(target), std::move(storage));
+  }
+
+  Parsing::Target::Ptr CreateSaveTarget(FilesStorage::Ptr storage)
   {
-    return MakePtr<SaveTarget>();
+    return MakePtr<SaveTarget>(std::move(storage));
   }
 
   Parsing::Target::Ptr CreateStatisticTarget()
@@ -521,15 +817,17 @@ namespace
   class NestedScannerTarget : public Analysis::Scanner::Target
   {
   public:
-    NestedScannerTarget(Analysis::Node::Ptr root, Analysis::NodeReceiver& toScan, Analysis::NodeReceiver& toStore)
+    NestedScannerTarget(Analysis::Node::Ptr root, uint64_t base, Analysis::NodeReceiver& toScan, Analysis::NodeReceiver& toStore)
       : Root(std::move(root))
+      , Base(base)
       , ToScan(toScan)
       , ToStore(toStore)
     {
     }
 
-    void Apply(const Formats::Archived::Decoder& decoder, std::size_t offset, Formats::Archived::Container::Ptr data) override
+    void Apply(const Formats::Archived::Decoder& decoder, std::size_t relOffset, Formats::Archived::Container::Ptr data) override
     {
+      const uint64_t offset = Base + relOffset;
       const String name = decoder.GetDescription();
       Dbg("Found %1% in %2% bytes at %3%", name, data->Size(), offset);
       auto archNode = Analysis::CreateSubnode(Root, data, name, offset);
@@ -537,32 +835,36 @@ namespace
       data->ExploreFiles(walker);
     }
 
-    void Apply(const Formats::Packed::Decoder& decoder, std::size_t offset, Formats::Packed::Container::Ptr data) override
+    void Apply(const Formats::Packed::Decoder& decoder, std::size_t relOffset, Formats::Packed::Container::Ptr data) override
     {
+      const uint64_t offset = Base + relOffset;
       const String name = decoder.GetDescription();
       Dbg("Found %1% in %2% bytes at %3%", name, data->PackedSize(), offset);
       auto packNode = Analysis::CreateSubnode(Root, std::move(data), name, offset);
       ToScan.ApplyData(std::move(packNode));
     }
 
-    void Apply(const Formats::Image::Decoder& decoder, std::size_t offset, Formats::Image::Container::Ptr data) override
+    void Apply(const Formats::Image::Decoder& decoder, std::size_t relOffset, Formats::Image::Container::Ptr data) override
     {
+      const uint64_t offset = Base + relOffset;
       const String name = decoder.GetDescription();
       Dbg("Found %1% in %2% bytes at %3%", name, data->OriginalSize(), offset);
       auto imageNode = Analysis::CreateSubnode(Root, std::move(data), Strings::Format("+%1%.image", offset));
       ToStore.ApplyData(std::move(imageNode));
     }
 
-    void Apply(const Formats::Chiptune::Decoder& decoder, std::size_t offset, Formats::Chiptune::Container::Ptr data) override
+    void Apply(const Formats::Chiptune::Decoder& decoder, std::size_t relOffset, Formats::Chiptune::Container::Ptr data) override
     {
+      const uint64_t offset = Base + relOffset;
       const String name = decoder.GetDescription();
       Dbg("Found %1% in %2% bytes at %3%", name, data->Size(), offset);
       auto chiptuneNode = Analysis::CreateSubnode(Root, std::move(data), Strings::Format("+%1%.chiptune", offset));
       ToStore.ApplyData(std::move(chiptuneNode));
     }
 
-    void Apply(std::size_t offset, Binary::Container::Ptr data) override
+    void Apply(std::size_t relOffset, Binary::Container::Ptr data) override
     {
+      const uint64_t offset = Base + relOffset;
       Dbg("Unresolved %1% bytes at %2%", data->Size(), offset);
       auto rawNode = Analysis::CreateSubnode(Root, std::move(data), offset);
       ToStore.ApplyData(std::move(rawNode));
@@ -593,6 +895,7 @@ namespace
     };
   private:
     const Analysis::Node::Ptr Root;
+    const uint64_t Base;
     Analysis::NodeReceiver& ToScan;
     Analysis::NodeReceiver& ToStore;
   };
@@ -612,10 +915,19 @@ namespace
     void ApplyData(Analysis::Node::Ptr node) override
     {
       Dbg("Analyze %1%", node->Name());
-      NestedScannerTarget target(node, *this, *Target);
       try
       {
-        Scanner->Scan(node->Data(), target);
+        if (const WindowNode* window = dynamic_cast<const WindowNode*>(node.get()))
+        {
+          Dbg("Window at %1% (%2%..%3%)", window->Base(), window->ReportFrom(), window->ReportTill());
+          NestedScannerTarget target(node, window->Base(), *this, *Target);
+          Scanner->Scan(node->Data(), window->ReportFrom(), window->ReportTill(), target);
+        }
+        else
+        {
+          NestedScannerTarget target(node, 0, *this, *Target);
+          Scanner->Scan(node->Data(), target);
+        }
       }
       catch (const std::exception& e)
       {
@@ -647,9 +959,11 @@ namespace
   class OpenPointImpl : public OpenPoint
   {
   public:
-    OpenPointImpl()
+    OpenPointImpl(std::size_t windowSize, std::size_t windowOverlap)
       : Analyse(Analysis::NodeReceiver::CreateStub())
       , Params(Parameters::Container::Create())
+      , WindowSize(windowSize)
+      , WindowOverlap(windowOverlap)
     {
     }
 
@@ -657,6 +971,10 @@ namespace
     {
       try
       {
+        if (WindowSize && OpenWindows(filename))
+        {
+          return;
+        }
         Dbg("Opening '%1%'", filename);
         const Binary::Container::Ptr data = IO::OpenData(filename, *Params, Log::ProgressCallback::Stub());
         auto root = Analysis::CreateRootNode(data, filename);
@@ -666,6 +984,10 @@ namespace
       {
         std::cout << e.ToString();
       }
+      catch (const std::exception& e)
+      {
+        std::cout << e.what() << std::endl;
+      }
     }
 
     void Flush() override
@@ -678,9 +1000,49 @@ namespace
       assert(analyse);
       Analyse = analyse;
     }
+  private:
+    /*
+      Huge local files are read by windows overlapped with neighbours, so data crossing window bounds is found
+      by both of them. Each window reports only data started in its own part, so peak memory usage is limited
+      by queued windows regardless of input size.
+    */
+    bool OpenWindows(const String& filename) const
+    {
+      const boost::filesystem::path path(filename);
+      if (!boost::filesystem::is_regular_file(path))
+      {
+        return false;
+      }
+      //file size may exceed address space, so absolute offsets are 64-bit while window itself fits memory
+      const uint64_t size = boost::filesystem::file_size(path);
+      if (size <= WindowSize)
+      {
+        return false;
+      }
+      Dbg("Opening '%1%' by %2% bytes windows", filename, WindowSize);
+      boost::filesystem::ifstream stream(path, std::ios::binary);
+      for (uint64_t from = 0; from < size; from += WindowSize)
+      {
+        const uint64_t base = from > WindowOverlap ? from - WindowOverlap : 0;
+        const uint64_t till = std::min<uint64_t>(from + WindowSize, size);
+        const uint64_t end = std::min<uint64_t>(till + WindowOverlap, size);
+        std::unique_ptr<Dump> content(new Dump(static_cast<std::size_t>(end - base)));
+        if (!stream.seekg(static_cast<std::streamoff>(base)).read(safe_ptr_cast<char*>(content->data()), content->size()))
+        {
+          throw Error(THIS_LINE, Strings::Format(Text::WINDOW_READ_FAILED, filename, base));
+        }
+        const std::size_t reportFrom = static_cast<std::size_t>(from - base);
+        const std::size_t reportTill = static_cast<std::size_t>(till - base);
+        auto window = MakePtr<WindowNode>(Binary::CreateContainer(std::move(content)), filename, base, reportFrom, reportTill);
+        Analyse->ApplyData(std::move(window));
+      }
+      return true;
+    }
   private:
     Analysis::NodeReceiver::Ptr Analyse;
     const Parameters::Accessor::Ptr Params;
+    const std::size_t WindowSize;
+    const std::size_t WindowOverlap;
   };
 
   class PathTemplate : public Strings::FieldsSource
@@ -908,6 +1270,7 @@ namespace
     virtual std::size_t SaveThreadsCount() const = 0;
     virtual std::size_t SaveDataQueueSize() const = 0;
     virtual bool StatisticOutput() const = 0;
+    virtual DuplicatesMode Duplicates() const = 0;
   };
 
   class AnalysisOptions
@@ -917,14 +1280,27 @@ namespace
 
     virtual std::size_t AnalysisThreads() const = 0;
     virtual std::size_t AnalysisDataQueueSize() const = 0;
+    virtual std::size_t WindowSize() const = 0;
+    virtual std::size_t WindowOverlap() const = 0;
   };
 
   Analysis::NodeReceiver::Ptr CreateTarget(const TargetOptions& opts)
   {
-    const Parsing::Target::Ptr save = opts.StatisticOutput()
-      ? Parsing::CreateStatisticTarget()
-      : Parsing::CreateSaveTarget();
-    const Analysis::NodeReceiver::Ptr makeName = MakePtr<TargetNamePoint>(opts.TargetNameTemplate(), save);
+    const FilesStorage::Ptr storage = opts.StatisticOutput()
+      ? FilesStorage::Ptr()
+      : std::make_shared<FilesStorage>();
+    const Parsing::Target::Ptr save = storage
+      ? Parsing::CreateSaveTarget(storage)
+      : Parsing::CreateStatisticTarget();
+    const DuplicatesMode duplicates = !storage && opts.Duplicates() == LINK_DUPLICATES
+      ? SKIP_DUPLICATES
+      : opts.Duplicates();
+    const Parsing::Target::Ptr dedup = duplicates == LINK_DUPLICATES
+      ? Parsing::CreateLinkDuplicatesTarget(save, storage)
+      : (duplicates == SKIP_DUPLICATES
+        ? Parsing::CreateDeduplicateTarget(save)
+        : save);
+    const Analysis::NodeReceiver::Ptr makeName = MakePtr<TargetNamePoint>(opts.TargetNameTemplate(), dedup);
     const Analysis::NodeReceiver::Ptr storeAll = makeName;
     const Analysis::NodeReceiver::Ptr storeNoEmpty = opts.IgnoreEmptyData()
       ? Analysis::CreateEmptyDataFilter(storeAll)
@@ -977,9 +1353,9 @@ namespace
     return MakePtr<TransceivePipe<Analysis::Node::Ptr> >(input, analyser);
   }
 
-  OpenPoint::Ptr CreateSource()
+  OpenPoint::Ptr CreateSource(const AnalysisOptions& opts)
   {
-    const OpenPoint::Ptr open = MakePtr<OpenPointImpl>();
+    const OpenPoint::Ptr open = MakePtr<OpenPointImpl>(opts.WindowSize(), opts.WindowOverlap());
     const ResolveDirsPoint::Ptr resolve = MakePtr<ResolveDirsPoint>();
     resolve->SetTarget(open);
     return MakePtr<TransceivePipe<String, Analysis::Node::Ptr> >(resolve, open);
@@ -992,6 +1368,8 @@ namespace
     Options()
       : AnalysisThreadsValue(1)
       , AnalysisDataQueueSizeValue(10)
+      , WindowSizeValue(0)
+      , WindowOverlapValue(4194304)
       , TargetNameTemplateValue(Text::DEFAULT_TARGET_NAME_TEMPLATE)
       , IgnoreEmptyDataValue(false)
       , MinDataSizeValue(0)
@@ -999,6 +1377,7 @@ namespace
       , SaveThreadsCountValue(1)
       , SaveDataQueueSizeValue(500)
       , StatisticOutputValue(false)
+      , DuplicatesValue(Text::DUPLICATES_KEEP)
       //cmdline
       , OptionsDescription(Text::TARGET_SECTION)
     {
@@ -1006,6 +1385,8 @@ namespace
       OptionsDescription.add_options()
         (Text::ANALYSIS_THREADS_KEY, value<std::size_t>(&AnalysisThreadsValue), Text::ANALYSIS_THREADS_DESC)
         (Text::ANALYSIS_QUEUE_SIZE_KEY, value<std::size_t>(&AnalysisDataQueueSizeValue), Text::ANALYSIS_QUEUE_SIZE_DESC)
+        (Text::WINDOW_SIZE_KEY, value<std::size_t>(&WindowSizeValue), Text::WINDOW_SIZE_DESC)
+        (Text::WINDOW_OVERLAP_KEY, value<std::size_t>(&WindowOverlapValue), Text::WINDOW_OVERLAP_DESC)
         (Text::TARGET_NAME_TEMPLATE_KEY, value<String>(&TargetNameTemplateValue), Text::TARGET_NAME_TEMPLATE_DESC)
         (Text::IGNORE_EMPTY_KEY, bool_switch(&IgnoreEmptyDataValue), Text::IGNORE_EMPTY_DESC)
         (Text::MINIMAL_SIZE_KEY, value<std::size_t>(&MinDataSizeValue), Text::MINIMAL_SIZE_DESC)
@@ -1013,6 +1394,7 @@ namespace
         (Text::SAVE_THREADS_KEY, value<std::size_t>(&SaveThreadsCountValue), Text::SAVE_THREADS_DESC)
         (Text::SAVE_QUEUE_SIZE_KEY, value<std::size_t>(&SaveDataQueueSizeValue), Text::SAVE_QUEUE_SIZE_DESC)
         (Text::OUTPUT_STATISTIC_KEY, bool_switch(&StatisticOutputValue), Text::OUTPUT_STATISTIC_DESC)
+        (Text::DUPLICATES_KEY, value<String>(&DuplicatesValue), Text::DUPLICATES_DESC)
        ;
     }
 
@@ -1026,6 +1408,16 @@ namespace
       return AnalysisDataQueueSizeValue;
     }
 
+    std::size_t WindowSize() const override
+    {
+      return WindowSizeValue;
+    }
+
+    std::size_t WindowOverlap() const override
+    {
+      return WindowOverlapValue;
+    }
+
     String TargetNameTemplate() const override
     {
       return TargetNameTemplateValue;
@@ -1061,6 +1453,34 @@ namespace
       return StatisticOutputValue;
     }
 
+    DuplicatesMode Duplicates() const override
+    {
+      if (DuplicatesValue == Text::DUPLICATES_SKIP)
+      {
+        return SKIP_DUPLICATES;
+      }
+      else if (DuplicatesValue == Text::DUPLICATES_LINK)
+      {
+        return LINK_DUPLICATES;
+      }
+      else
+      {
+        return KEEP_DUPLICATES;
+      }
+    }
+
+    bool HasValidDuplicates() const
+    {
+      return DuplicatesValue == Text::DUPLICATES_KEEP
+          || DuplicatesValue == Text::DUPLICATES_SKIP
+          || DuplicatesValue == Text::DUPLICATES_LINK;
+    }
+
+    String DuplicatesName() const
+    {
+      return DuplicatesValue;
+    }
+
     const boost::program_options::options_description& GetOptionsDescription() const
     {
       return OptionsDescription;
@@ -1068,6 +1488,8 @@ namespace
   private:
     std::size_t AnalysisThreadsValue;
     std::size_t AnalysisDataQueueSizeValue;
+    std::size_t WindowSizeValue;
+    std::size_t WindowOverlapValue;
     String TargetNameTemplateValue;
     bool IgnoreEmptyDataValue;
     std::size_t MinDataSizeValue;
@@ -1075,6 +1497,7 @@ namespace
     std::size_t SaveThreadsCountValue;
     std::size_t SaveDataQueueSizeValue;
     bool StatisticOutputValue;
+    String DuplicatesValue;
     boost::program_options::options_description OptionsDescription;
   };
 }
@@ -1105,7 +1528,7 @@ public:
     */
     const Analysis::NodeReceiver::Ptr result = CreateTarget(Opts);
     const Analysis::NodeTransceiver::Ptr analyse = CreateAnalyser(Opts);
-    const OpenPoint::Ptr input = CreateSource();
+    const OpenPoint::Ptr input = CreateSource(Opts);
 
     input->SetTarget(analyse);
     analyse->SetTarget(result);
@@ -1146,6 +1569,11 @@ private:
       std::cout << options << std::endl;
       return false;
     }
+    else if (!Opts.HasValidDuplicates())
+    {
+      std::cout << Strings::Format(Text::DUPLICATES_INVALID, Opts.DuplicatesName()) << std::endl;
+      return false;
+    }
     return true;
   }
 private:
@@ -24,6 +24,36 @@ extern const Char DEFAULT_TARGET_NAME_TEMPLATE[] = {
   'X','T','r','a','c','t','o','r','/','[','F','i','l','e','n','a','m','e',']','/','[','S','u','b','p','a','t',
   'h',']',0
 };
+extern const Char DUPLICATES_DESC[] = {
+  'd','u','p','l','i','c','a','t','e','d',' ','d','a','t','a',' ','p','r','o','c','e','s','s','i','n','g',' ',
+  'm','o','d','e',':',' ','k','e','e','p',' ','(','s','t','o','r','e',' ','a','l','l',' ','t','h','e',' ','c',
+  'o','p','i','e','s',')',',',' ','s','k','i','p',' ','(','s','t','o','r','e',' ','o','n','l','y',' ','f','i',
+  'r','s','t',' ','c','o','p','y',')',' ','o','r',' ','l','i','n','k',' ','(','m','a','k','e',' ','h','a','r',
+  'd',' ','l','i','n','k','s',' ','t','o',' ','f','i','r','s','t',' ','c','o','p','y',')','.',' ','D','u','p',
+  'l','i','c','a','t','e','s',' ','a','r','e',' ','d','e','t','e','c','t','e','d',' ','b','y',' ','S','H','A',
+  '-','2','5','6',' ','d','i','g','e','s','t',' ','a','n','d',' ','s','i','z','e','.',' ','D','e','f','a','u',
+  'l','t',' ','i','s',' ','k','e','e','p',0
+};
+extern const Char DUPLICATES_INVALID[] = {
+  'I','n','v','a','l','i','d',' ','d','u','p','l','i','c','a','t','e','s',' ','p','r','o','c','e','s','s','i',
+  'n','g',' ','m','o','d','e',' ','\'','%','1','%','\'',0
+};
+extern const Char DUPLICATES_KEEP[] = {
+  'k','e','e','p',0
+};
+extern const Char DUPLICATES_KEY[] = {
+  'd','u','p','l','i','c','a','t','e','s',0
+};
+extern const Char DUPLICATES_LINK[] = {
+  'l','i','n','k',0
+};
+extern const Char DUPLICATES_OUTPUT[] = {
+  '%','1','%',' ','d','u','p','l','i','c','a','t','e','s',' ','f','o','u','n','d','.',' ','T','o','t','a','l',
+  ' ','s','i','z','e',' ','i','s',' ','%','2','%',' ','b','y','t','e','s',0
+};
+extern const Char DUPLICATES_SKIP[] = {
+  's','k','i','p',0
+};
 extern const Char FORMAT_FILTER_DESC[] = {
   's','p','e','c','i','f','y',' ','f','u','z','z','y',' ','d','a','t','a',' ','f','o','r','m','a','t',' ','t',
   'o',' ','s','a','v','e',0
@@ -51,6 +81,11 @@ extern const Char INPUT_DESC[] = {
 extern const Char INPUT_KEY[] = {
   'i','n','p','u','t',0
 };
+extern const Char LINK_FAILED[] = {
+  'F','a','i','l','e','d',' ','t','o',' ','l','i','n','k',' ','%','1','%',' ','t','o',' ','%','2','%',' ','(',
+  '%','3','%',')','\n',
+  0
+};
 extern const Char MINIMAL_SIZE_DESC[] = {
   'd','o',' ','n','o','t',' ','s','t','o','r','e',' ','f','i','l','e','s',' ','w','i','t','h',' ','l','e','s',
   's','e','r',' ','s','i','z','e','.',' ','D','e','f','a','u','l','t',' ','i','s',' ','0',0
@@ -128,4 +163,29 @@ extern const Char VERSION_DESC[] = {
 extern const Char VERSION_KEY[] = {
   'v','e','r','s','i','o','n',0
 };
+extern const Char WINDOW_OVERLAP_DESC[] = {
+  's','i','z','e',' ','o','f',' ','w','i','n','d','o','w','s',' ','o','v','e','r','l','a','p','p','i','n','g',
+  '.',' ','S','h','o','u','l','d',' ','n','o','t',' ','b','e',' ','l','e','s','s',' ','t','h','a','n',' ','m',
+  'a','x','i','m','a','l',' ','s','i','z','e',' ','o','f',' ','d','a','t','a',' ','t','o',' ','b','e',' ','f',
+  'o','u','n','d','.',' ','V','a','l','u','a','b','l','e',' ','o','n','l','y',' ','w','h','e','n',' ','-','-',
+  'w','i','n','d','o','w','-','s','i','z','e',' ','>',' ','0','.',' ','D','e','f','a','u','l','t',' ','i','s',
+  ' ','4','1','9','4','3','0','4',0
+};
+extern const Char WINDOW_OVERLAP_KEY[] = {
+  'w','i','n','d','o','w','-','o','v','e','r','l','a','p',0
+};
+extern const Char WINDOW_READ_FAILED[] = {
+  'F','a','i','l','e','d',' ','t','o',' ','r','e','a','d',' ','\'','%','1','%','\'',' ','a','t',' ','%','2','%',0
+};
+extern const Char WINDOW_SIZE_DESC[] = {
+  's','c','a','n',' ','l','o','c','a','l',' ','f','i','l','e','s',' ','b','i','g','g','e','r',' ','t','h','a',
+  'n',' ','s','p','e','c','i','f','i','e','d',' ','s','i','z','e',' ','b','y',' ','o','v','e','r','l','a','p',
+  'p','e','d',' ','w','i','n','d','o','w','s',' ','o','f',' ','t','h','i','s',' ','s','i','z','e',' ','t','o',
+  ' ','l','i','m','i','t',' ','m','e','m','o','r','y',' ','u','s','a','g','e','.',' ','0',' ','t','o',' ','d',
+  'i','s','a','b','l','e',' ','w','i','n','d','o','w','e','d',' ','s','c','a','n','n','i','n','g','.',' ','D',
+  'e','f','a','u','l','t',' ','i','s',' ','0',0
+};
+extern const Char WINDOW_SIZE_KEY[] = {
+  'w','i','n','d','o','w','-','s','i','z','e',0
+};
 }//namespace Text
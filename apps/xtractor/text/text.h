@@ -8,6 +8,13 @@ extern const Char ANALYSIS_QUEUE_SIZE_KEY[];
 extern const Char ANALYSIS_THREADS_DESC[];
 extern const Char ANALYSIS_THREADS_KEY[];
 extern const Char DEFAULT_TARGET_NAME_TEMPLATE[];
+extern const Char DUPLICATES_DESC[];
+extern const Char DUPLICATES_INVALID[];
+extern const Char DUPLICATES_KEEP[];
+extern const Char DUPLICATES_KEY[];
+extern const Char DUPLICATES_LINK[];
+extern const Char DUPLICATES_OUTPUT[];
+extern const Char DUPLICATES_SKIP[];
 extern const Char FORMAT_FILTER_DESC[];
 extern const Char FORMAT_FILTER_KEY[];
 extern const Char HELP_DESC[];
@@ -16,6 +23,7 @@ extern const Char IGNORE_EMPTY_DESC[];
 extern const Char IGNORE_EMPTY_KEY[];
 extern const Char INPUT_DESC[];
 extern const Char INPUT_KEY[];
+extern const Char LINK_FAILED[];
 extern const Char MINIMAL_SIZE_DESC[];
 extern const Char MINIMAL_SIZE_KEY[];
 extern const Char OUTPUT_STATISTIC_DESC[];
@@ -37,4 +45,9 @@ extern const Char TEMPLATE_FIELD_SUBPATH[];
 extern const Char USAGE_SECTION[];
 extern const Char VERSION_DESC[];
 extern const Char VERSION_KEY[];
+extern const Char WINDOW_OVERLAP_DESC[];
+extern const Char WINDOW_OVERLAP_KEY[];
+extern const Char WINDOW_READ_FAILED[];
+extern const Char WINDOW_SIZE_DESC[];
+extern const Char WINDOW_SIZE_KEY[];
 }//namespace Text
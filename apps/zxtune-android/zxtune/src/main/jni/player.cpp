@@ -155,9 +155,10 @@ namespace
 
     uint_t Analyze(uint_t maxEntries, uint32_t* bands, uint32_t* levels) const override
     {
-      const auto& result = Analyser->GetState();
+      AnalyserState.clear();
+      Analyser->GetState(AnalyserState);
       uint_t doneEntries = 0;
-      for (auto it = result.begin(), lim = result.end(); it != lim && doneEntries != maxEntries; ++it, ++doneEntries)
+      for (auto it = AnalyserState.begin(), lim = AnalyserState.end(); it != lim && doneEntries != maxEntries; ++it, ++doneEntries)
       {
         bands[doneEntries] = it->Band;
         levels[doneEntries] = it->Level;
@@ -205,6 +206,8 @@ namespace
     const BufferTarget::Ptr Buffer;
     const Module::TrackState::Ptr TrackState;
     const Module::Analyzer::Ptr Analyser;
+    //reused between calls to avoid allocations
+    mutable std::vector<Module::Analyzer::ChannelState> AnalyserState;
     RenderingPerformanceAccountant RenderingPerformance;
   };
 
@@ -44,6 +44,10 @@ namespace
       Item = item;
     }
 
+    void ProcessData(Binary::Data::Ptr /*data*/) override
+    {
+    }
+
     Log::ProgressCallback* GetProgress() const override
     {
       return nullptr;
@@ -165,6 +169,7 @@ namespace
       : Provider(std::move(provider))
       , Params(Parameters::CreateMergedAccessor(Module::CreatePathProperties(item.Path), item.AdjustedParameters, playlistParams))
       , Path(item.Path)
+      , PluginId(item.PluginId)
     {
     }
 
@@ -173,7 +178,7 @@ namespace
       try
       {
         CollectorStub collector(*Params);
-        Provider->OpenModule(Path, collector);
+        Provider->OpenModule(Path, PluginId, collector);
         return collector.GetItem();
       }
       catch (const Error& e)
@@ -197,6 +202,7 @@ namespace
     const Playlist::Item::DataProvider::Ptr Provider;
     const Parameters::Accessor::Ptr Params;
     const String Path;
+    const String PluginId;
   };
 
   class DelayLoadItemData : public Playlist::Item::Data
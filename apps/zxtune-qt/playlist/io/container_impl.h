@@ -24,6 +24,8 @@ namespace Playlist
     {
       String Path;
       Parameters::Accessor::Ptr AdjustedParameters;
+      //plugin the item was detected by, used as hint to open it
+      String PluginId;
     };
 
     struct ContainerItems : std::vector<ContainerItem>
@@ -111,6 +111,38 @@ namespace
     const bool Match;
   };
 
+  class PluginIdCollector : public Parameters::Visitor
+  {
+  public:
+    PluginIdCollector(Parameters::Visitor& delegate, String& pluginId)
+      : Delegate(delegate)
+      , PluginId(pluginId)
+    {
+    }
+
+    void SetValue(const Parameters::NameType& name, Parameters::IntType val) override
+    {
+      Delegate.SetValue(name, val);
+    }
+
+    void SetValue(const Parameters::NameType& name, const Parameters::StringType& val) override
+    {
+      if (name == Module::ATTR_TYPE)
+      {
+        PluginId = val;
+      }
+      Delegate.SetValue(name, val);
+    }
+
+    void SetValue(const Parameters::NameType& name, const Parameters::DataType& val) override
+    {
+      Delegate.SetValue(name, val);
+    }
+  private:
+    Parameters::Visitor& Delegate;
+    String& PluginId;
+  };
+
   class XSPFReader
   {
   public:
@@ -230,7 +262,7 @@ namespace
         }
         else
         {
-          ParseTrackitemParameters(tagName, *parameters);
+          ParseTrackitemParameters(tagName, *parameters, item.PluginId);
         }
       }
       if (!item.Path.empty())
@@ -253,7 +285,7 @@ namespace
       return FromQString(itemLocation);
     }
 
-    void ParseTrackitemParameters(const QStringRef& attr, Parameters::Visitor& props)
+    void ParseTrackitemParameters(const QStringRef& attr, Parameters::Visitor& props, String& pluginId)
     {
       assert(XML.isStartElement() && XML.name() == attr);
       if (attr == XSPF::ITEM_CREATOR_TAG)
@@ -278,7 +310,9 @@ namespace
       {
         Dbg("  parsing extension");
         PropertiesFilter filter(props, &IsItemDisabledProperty, false);
-        ParseExtension(filter);
+        //type is not kept in adjusted parameters but useful as open hint
+        PluginIdCollector collector(filter, pluginId);
+        ParseExtension(collector);
       }
       else
       {
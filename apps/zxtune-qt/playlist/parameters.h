@@ -83,6 +83,31 @@ namespace Parameters
         //@}
       }
 
+      namespace Scan
+      {
+        const std::string NAMESPACE_NAME("Scan");
+
+        const NameType PREFIX = Playlist::PREFIX + NAMESPACE_NAME;
+
+        //@{
+        //! @name Detect modules only in new or changed files, use previous results for the rest
+
+        //! Parameter name
+        const NameType INCREMENTAL = PREFIX + "Incremental";
+        //! Default value
+        const IntType INCREMENTAL_DEFAULT = 0;
+        //@}
+
+        //@{
+        //! @name Add files appeared in scanned folders automatically
+
+        //! Parameter name
+        const NameType WATCH_FOLDERS = PREFIX + "WatchFolders";
+        //! Default value
+        const IntType WATCH_FOLDERS_DEFAULT = 0;
+        //@}
+      }
+
       namespace Store
       {
         const std::string NAMESPACE_NAME("Store");
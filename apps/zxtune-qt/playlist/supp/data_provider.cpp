@@ -355,11 +355,11 @@ namespace
     {
     }
 
-    Module::Holder::Ptr GetModule(Parameters::Accessor::Ptr adjustedParams) const
+    Module::Holder::Ptr GetModule(Parameters::Accessor::Ptr adjustedParams, const String& pluginId) const
     {
       const Binary::Container::Ptr data = Source->GetData();
       const auto& subpath = ModuleId->Subpath();
-      const Module::Holder::Ptr module = Module::Open(*CoreParams, data, subpath);
+      const Module::Holder::Ptr module = Module::Open(*CoreParams, data, subpath, pluginId);
       if (subpath.empty())
       {
         if (const auto files = dynamic_cast<const Module::AdditionalFiles*>(module.get()))
@@ -470,7 +470,7 @@ namespace
       try
       {
         State = Error();
-        return Source.GetModule(AdjustedParams);
+        return Source.GetModule(AdjustedParams, Type);
       }
       catch (const Error& e)
       {
@@ -693,22 +693,28 @@ namespace
       if (subPath.empty())
       {
         const Binary::Container::Ptr data = Provider->GetData(id->Path());
+        detectParams.ProcessData(data);
         const DetectCallback detectCallback(detectParams, Attributes, Provider, CoreParams, id);
         Module::Detect(*CoreParams, data, detectCallback);
       }
       else
       {
-        OpenModule(path, detectParams);
+        OpenModule(path, String(), detectParams);
       }
     }
 
-    void OpenModule(const String& path, Playlist::Item::DetectParameters& detectParams) const override
+    void OpenModule(const String& path, const String& pluginId, Playlist::Item::DetectParameters& detectParams) const override
     {
       const IO::Identifier::Ptr id = IO::ResolveUri(path);
 
       const Binary::Container::Ptr data = Provider->GetData(id->Path());
       const DetectCallback detectCallback(detectParams, Attributes, Provider, CoreParams, id);
-      Module::Open(*CoreParams, data, id->Subpath(), detectCallback);
+      Module::Open(*CoreParams, data, id->Subpath(), pluginId, detectCallback);
+    }
+
+    Binary::Container::Ptr GetData(const String& path) const override
+    {
+      return Provider->GetData(IO::ResolveUri(path)->Path());
     }
   private:
     const CachedDataProvider::Ptr Provider;
@@ -14,6 +14,8 @@
 #include "data.h"
 //common includes
 #include <progress_callback.h>
+//library includes
+#include <binary/container.h>
 
 namespace Playlist
 {
@@ -26,6 +28,8 @@ namespace Playlist
 
       virtual Parameters::Container::Ptr CreateInitialAdjustedParameters() const = 0;
       virtual void ProcessItem(Data::Ptr item) = 0;
+      //! @brief Called with the whole file content before modules detection
+      virtual void ProcessData(Binary::Data::Ptr data) = 0;
       virtual Log::ProgressCallback* GetProgress() const = 0;
     };
 
@@ -38,7 +42,11 @@ namespace Playlist
 
       virtual void DetectModules(const String& path, DetectParameters& detectParams) const = 0;
 
-      virtual void OpenModule(const String& path, DetectParameters& detectParams) const = 0;
+      //! @param pluginId Plugin the module was detected by before, tried first. May be empty
+      virtual void OpenModule(const String& path, const String& pluginId, DetectParameters& detectParams) const = 0;
+
+      //! @brief Content of file (cached, so subsequent detection does not read it again)
+      virtual Binary::Container::Ptr GetData(const String& path) const = 0;
 
       static Ptr Create(Parameters::Accessor::Ptr parameters);
     };
@@ -0,0 +1,81 @@
+/**
+* 
+* @file
+*
+* @brief Folders watcher implementation
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+//local includes
+#include "folders_watcher.h"
+#include "ui/utils.h"
+//common includes
+#include <contract.h>
+//library includes
+#include <debug/log.h>
+//qt includes
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QFileSystemWatcher>
+
+namespace
+{
+  const Debug::Stream Dbg("Playlist::FoldersWatcher");
+
+  //new nested folders are usually empty at notification time, so only files are tracked
+  QSet<QString> ListFiles(const QString& path)
+  {
+    const QDir dir(path);
+    QSet<QString> result;
+    for (const auto& entry : dir.entryList(QDir::Files | QDir::NoDotAndDotDot | QDir::Hidden))
+    {
+      result.insert(dir.absoluteFilePath(entry));
+    }
+    return result;
+  }
+}
+
+namespace Playlist
+{
+  FoldersWatcher::FoldersWatcher(QObject& parent, Target& target)
+    : QObject(&parent)
+    , Delegate(target)
+    , Watcher(new QFileSystemWatcher(this))
+  {
+    Require(connect(Watcher, SIGNAL(directoryChanged(const QString&)), SLOT(DirectoryChanged(const QString&))));
+  }
+
+  void FoldersWatcher::Watch(const QStringList& items)
+  {
+    for (const auto& item : items)
+    {
+      if (!Folders.contains(item) && QFileInfo(item).isDir())
+      {
+        Dbg("Watch folder '%1%'", FromQString(item));
+        Folders.insert(item, ListFiles(item));
+        Watcher->addPath(item);
+      }
+    }
+  }
+
+  void FoldersWatcher::DirectoryChanged(const QString& path)
+  {
+    if (!QFileInfo(path).isDir())
+    {
+      Dbg("Folder '%1%' is removed", FromQString(path));
+      Folders.remove(path);
+      return;
+    }
+    const QSet<QString> content = ListFiles(path);
+    QSet<QString>& known = Folders[path];
+    const QStringList added = QSet<QString>(content).subtract(known).toList();
+    known = content;
+    if (!added.isEmpty())
+    {
+      Dbg("Found %1% new files in '%2%'", added.size(), FromQString(path));
+      Delegate.OnFilesAdded(added);
+    }
+  }
+}
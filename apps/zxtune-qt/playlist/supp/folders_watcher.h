@@ -0,0 +1,48 @@
+/**
+* 
+* @file
+*
+* @brief Folders watcher interface
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+#pragma once
+
+//qt includes
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+#include <QtCore/QSet>
+#include <QtCore/QStringList>
+
+class QFileSystemWatcher;
+
+namespace Playlist
+{
+  //! @brief Reports files appeared in explicitly added folders. Nested folders are not watched
+  class FoldersWatcher : public QObject
+  {
+    Q_OBJECT
+  public:
+    class Target
+    {
+    public:
+      virtual ~Target() = default;
+
+      virtual void OnFilesAdded(const QStringList& files) = 0;
+    };
+
+    FoldersWatcher(QObject& parent, Target& target);
+
+    //! Starts watching for folders from the list, other entries are ignored
+    void Watch(const QStringList& items);
+  private slots:
+    void DirectoryChanged(const QString& path);
+  private:
+    Target& Delegate;
+    QFileSystemWatcher* const Watcher;
+    //watched folder => its files
+    QHash<QString, QSet<QString> > Folders;
+  };
+}
@@ -0,0 +1,272 @@
+/**
+*
+* @file
+*
+* @brief Scan results index implementation
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+//local includes
+#include "scan_index.h"
+#include "ui/utils.h"
+//common includes
+#include <crc.h>
+//library includes
+#include <debug/log.h>
+//std includes
+#include <algorithm>
+#include <mutex>
+#include <vector>
+//qt includes
+#include <QtCore/QDataStream>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QHash>
+#include <QtGui/QDesktopServices>
+//text includes
+#include "text/text.h"
+
+namespace
+{
+  const Debug::Stream Dbg("Playlist::ScanIndex");
+
+  //should be changed on any format modification
+  const quint32 FORMAT_VERSION = 3;
+
+  //entries of files not looked up for this time are dropped
+  const uint MAX_ENTRY_AGE = 90 * 24 * 3600;
+  //precision of last lookup time, to avoid index rewriting on each lookup
+  const uint ENTRY_AGE_PRECISION = 24 * 3600;
+  //the least recently looked up entries are dropped to fit
+  const int MAX_ENTRIES = 100000;
+
+  struct FileState
+  {
+    qint64 Size;
+    uint Modified;
+    quint32 Hash;
+    QStringList Modules;
+    QStringList Types;
+    uint Checked;
+
+    FileState()
+      : Size()
+      , Modified()
+      , Hash()
+      , Checked()
+    {
+    }
+  };
+
+  QDataStream& operator << (QDataStream& stream, const FileState& state)
+  {
+    return stream << state.Size << state.Modified << state.Hash << state.Modules << state.Types << state.Checked;
+  }
+
+  QDataStream& operator >> (QDataStream& stream, FileState& state)
+  {
+    return stream >> state.Size >> state.Modified >> state.Hash >> state.Modules >> state.Types >> state.Checked;
+  }
+
+  quint32 CalculateHash(const Binary::Data& content)
+  {
+    return Crc32(static_cast<const uint8_t*>(content.Start()), content.Size());
+  }
+
+  uint GetCurrentTime()
+  {
+    return QDateTime::currentDateTime().toTime_t();
+  }
+
+  /*
+    Files are identified by size and modification time. Content hash is used to avoid rescanning
+    of touched or copied files with the same content. Content is passed by caller (taken from data
+    already opened for detection), so files are never read just for hashing.
+    Entries of files not looked up for a long time are dropped, and the count of entries is limited.
+  */
+  class PersistentScanIndex : public Playlist::ScanIndex
+  {
+  public:
+    PersistentScanIndex()
+      : FileName(QDir(QDesktopServices::storageLocation(QDesktopServices::DataLocation)).absoluteFilePath(QLatin1String(Text::SCAN_INDEX_FILE)))
+      , Changed(false)
+    {
+      Load();
+    }
+
+    ~PersistentScanIndex() override
+    {
+      Flush();
+    }
+
+    bool Find(const QString& path, const ContentSource& content, QStringList& modules, QStringList& types) override
+    {
+      const QFileInfo info(path);
+      FileState state;
+      {
+        const std::lock_guard<std::mutex> lock(Guard);
+        const auto it = Entries.find(path);
+        if (it == Entries.end())
+        {
+          return false;
+        }
+        else if (!info.isFile())
+        {
+          Entries.erase(it);
+          Changed = true;
+          return false;
+        }
+        state = it.value();
+      }
+      if (state.Size != info.size() || state.Modules.size() != state.Types.size())
+      {
+        return false;
+      }
+      bool updated = false;
+      const uint modified = info.lastModified().toTime_t();
+      if (state.Modified != modified)
+      {
+        const Binary::Data::Ptr data = content();
+        if (!data || state.Hash != CalculateHash(*data))
+        {
+          return false;
+        }
+        Dbg("Content of '%1%' is not changed", FromQString(path));
+        state.Modified = modified;
+        updated = true;
+      }
+      const uint now = GetCurrentTime();
+      if (state.Checked + ENTRY_AGE_PRECISION <= now)
+      {
+        state.Checked = now;
+        updated = true;
+      }
+      if (updated)
+      {
+        const std::lock_guard<std::mutex> lock(Guard);
+        Entries.insert(path, state);
+        Changed = true;
+      }
+      modules = state.Modules;
+      types = state.Types;
+      return true;
+    }
+
+    void Add(const QString& path, const Binary::Data& content, const QStringList& modules, const QStringList& types) override
+    {
+      const QFileInfo info(path);
+      if (!info.isFile())
+      {
+        return;
+      }
+      FileState state;
+      state.Size = info.size();
+      state.Modified = info.lastModified().toTime_t();
+      state.Hash = CalculateHash(content);
+      state.Modules = modules;
+      state.Types = types;
+      state.Checked = GetCurrentTime();
+      const std::lock_guard<std::mutex> lock(Guard);
+      Entries.insert(path, state);
+      Changed = true;
+    }
+
+    void Flush() override
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      Prune();
+      if (!Changed)
+      {
+        return;
+      }
+      QFileInfo(FileName).absoluteDir().mkpath(QLatin1String("."));
+      QFile file(FileName);
+      if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+      {
+        Dbg("Failed to open '%1%' for writing", FromQString(FileName));
+        return;
+      }
+      QDataStream stream(&file);
+      stream << FORMAT_VERSION << Entries;
+      Changed = false;
+      Dbg("Saved %1% entries", Entries.size());
+    }
+  private:
+    void Load()
+    {
+      QFile file(FileName);
+      if (!file.open(QIODevice::ReadOnly))
+      {
+        return;
+      }
+      QDataStream stream(&file);
+      quint32 version = 0;
+      stream >> version;
+      if (version != FORMAT_VERSION)
+      {
+        Dbg("Ignore index of version %1%", version);
+        return;
+      }
+      stream >> Entries;
+      if (stream.status() != QDataStream::Ok)
+      {
+        Dbg("Ignore corrupted index");
+        Entries.clear();
+        return;
+      }
+      Dbg("Loaded %1% entries", Entries.size());
+      Prune();
+    }
+
+    void Prune()
+    {
+      const int size = Entries.size();
+      const uint now = GetCurrentTime();
+      for (auto it = Entries.begin(); it != Entries.end();)
+      {
+        it = it.value().Checked + MAX_ENTRY_AGE < now ? Entries.erase(it) : it + 1;
+      }
+      if (Entries.size() > MAX_ENTRIES)
+      {
+        std::vector<uint> checked;
+        checked.reserve(Entries.size());
+        for (const auto& state : Entries)
+        {
+          checked.push_back(state.Checked);
+        }
+        const auto threshold = checked.begin() + (Entries.size() - MAX_ENTRIES);
+        std::nth_element(checked.begin(), threshold, checked.end());
+        //entries looked up at the threshold time are dropped only to fit the limit
+        for (auto it = Entries.begin(); it != Entries.end();)
+        {
+          const uint time = it.value().Checked;
+          const bool outdated = time < *threshold || (time == *threshold && Entries.size() > MAX_ENTRIES);
+          it = outdated ? Entries.erase(it) : it + 1;
+        }
+      }
+      if (const int dropped = size - Entries.size())
+      {
+        Dbg("Dropped %1% outdated entries", dropped);
+        Changed = true;
+      }
+    }
+  private:
+    const QString FileName;
+    std::mutex Guard;
+    QHash<QString, FileState> Entries;
+    bool Changed;
+  };
+}
+
+namespace Playlist
+{
+  ScanIndex& ScanIndex::Instance()
+  {
+    static PersistentScanIndex self;
+    return self;
+  }
+}
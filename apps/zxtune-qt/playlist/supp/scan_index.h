@@ -0,0 +1,47 @@
+/**
+*
+* @file
+*
+* @brief Scan results index interface
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+#pragma once
+
+//library includes
+#include <binary/data.h>
+//std includes
+#include <functional>
+//qt includes
+#include <QtCore/QStringList>
+
+namespace Playlist
+{
+  //! @brief Persistent storage of modules found in files during previous scans
+  class ScanIndex
+  {
+  public:
+    virtual ~ScanIndex() = default;
+
+    typedef std::function<Binary::Data::Ptr()> ContentSource;
+
+    //! @brief Lookup for modules found in file
+    //! @param path Local file path
+    //! @param content Called to get file content only if it's required to check changes
+    //! @param modules Full paths of found modules
+    //! @param types Types of found modules, in the same order as @p modules
+    //! @return false if file is not indexed or changed since indexing
+    virtual bool Find(const QString& path, const ContentSource& content, QStringList& modules, QStringList& types) = 0;
+
+    //! @brief Store modules found in file
+    //! @param content File content as it was scanned
+    virtual void Add(const QString& path, const Binary::Data& content, const QStringList& modules, const QStringList& types) = 0;
+
+    //! @brief Write changes to persistent storage
+    virtual void Flush() = 0;
+
+    static ScanIndex& Instance();
+  };
+}
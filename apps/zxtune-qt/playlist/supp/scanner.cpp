@@ -9,8 +9,12 @@
 **/
 
 //local includes
+#include "folders_watcher.h"
+#include "scan_index.h"
 #include "scanner.h"
 #include "playlist/io/import.h"
+#include "playlist/parameters.h"
+#include "supp/options.h"
 #include "ui/utils.h"
 //common includes
 #include <contract.h>
@@ -19,9 +23,11 @@
 //library includes
 #include <async/coroutine.h>
 #include <debug/log.h>
+#include <io/api.h>
 #include <time/elapsed.h>
 //std includes
 #include <mutex>
+#include <vector>
 //qt includes
 #include <QtCore/QDirIterator>
 #include <QtCore/QStringList>
@@ -169,6 +175,42 @@ namespace
     QStringList Cache;
   };
 
+  //hints io subsystem to read several next files while current one is processed
+  class ReadAheadFilenames : public FilenamesSource
+  {
+  public:
+    ReadAheadFilenames(FilenamesSource& delegate, int depth)
+      : Delegate(delegate)
+      , Depth(depth)
+    {
+    }
+
+    bool Empty() const override
+    {
+      return Window.isEmpty() && Delegate.Empty();
+    }
+
+    QString GetNext() override
+    {
+      if (Window.isEmpty())
+      {
+        Window.append(Delegate.GetNext());
+      }
+      const QString result = Window.takeFirst();
+      while (Window.size() < Depth && !Delegate.Empty())
+      {
+        const QString next = Delegate.GetNext();
+        IO::PrefetchData(FromQString(next));
+        Window.append(next);
+      }
+      return result;
+    }
+  private:
+    FilenamesSource& Delegate;
+    const int Depth;
+    QStringList Window;
+  };
+
   class FilenamesSourceStatistic : public FilenamesSource
   {
   public:
@@ -209,7 +251,8 @@ namespace
       : Resolved(Source)
       , ResolvedStatistic(Resolved)
       , Prefetched(ResolvedStatistic, 500, 1000)
-      , PrefetchedStatistic(Prefetched)
+      , ReadAhead(Prefetched, 4)
+      , PrefetchedStatistic(ReadAhead)
     {
     }
 
@@ -222,7 +265,7 @@ namespace
     //FilenamesSource
     bool Empty() const override
     {
-      return Prefetched.Empty();
+      return ReadAhead.Empty();
     }
 
     QString GetNext() override
@@ -257,6 +300,7 @@ namespace
     ResolvedFilenames Resolved;
     FilenamesSourceStatistic ResolvedStatistic;
     PrefetchedFilenames Prefetched;
+    ReadAheadFilenames ReadAhead;
     FilenamesSourceStatistic PrefetchedStatistic;
     QString Current;
   };
@@ -291,18 +335,95 @@ namespace
 
     void ProcessItem(Playlist::Item::Data::Ptr item) override
     {
+      Modules.append(ToQString(item->GetFullPath()));
+      Types.append(ToQString(item->GetType()));
       Callback.OnItem(item);
     }
 
+    void ProcessData(Binary::Data::Ptr data) override
+    {
+      Content = std::move(data);
+    }
+
     Log::ProgressCallback* GetProgress() const override
     {
       return &Progress;
     }
+
+    const QStringList& GetModules() const
+    {
+      return Modules;
+    }
+
+    const QStringList& GetTypes() const
+    {
+      return Types;
+    }
+
+    //! @return scanned content, empty if detection was not performed on whole file
+    Binary::Data::Ptr GetContent() const
+    {
+      return Content;
+    }
   private:
     ScannerCallback& Callback;
     Log::ProgressCallback& Progress;
+    QStringList Modules;
+    QStringList Types;
+    Binary::Data::Ptr Content;
+  };
+
+  //keeps items to pass them all at once
+  class CollectingDetectParams : public Playlist::Item::DetectParameters
+  {
+  public:
+    explicit CollectingDetectParams(Log::ProgressCallback& progress)
+      : Progress(progress)
+    {
+    }
+
+    Parameters::Container::Ptr CreateInitialAdjustedParameters() const override
+    {
+      return Parameters::Container::Create();
+    }
+
+    void ProcessItem(Playlist::Item::Data::Ptr item) override
+    {
+      Items.push_back(item);
+    }
+
+    void ProcessData(Binary::Data::Ptr /*data*/) override
+    {
+    }
+
+    Log::ProgressCallback* GetProgress() const override
+    {
+      return &Progress;
+    }
+
+    const std::vector<Playlist::Item::Data::Ptr>& GetItems() const
+    {
+      return Items;
+    }
+  private:
+    Log::ProgressCallback& Progress;
+    std::vector<Playlist::Item::Data::Ptr> Items;
   };
 
+  bool IsIncrementalScan()
+  {
+    Parameters::IntType val = Parameters::ZXTuneQT::Playlist::Scan::INCREMENTAL_DEFAULT;
+    GlobalOptions::Instance().Get()->FindValue(Parameters::ZXTuneQT::Playlist::Scan::INCREMENTAL, val);
+    return val != 0;
+  }
+
+  bool IsFoldersWatching()
+  {
+    Parameters::IntType val = Parameters::ZXTuneQT::Playlist::Scan::WATCH_FOLDERS_DEFAULT;
+    GlobalOptions::Instance().Get()->FindValue(Parameters::ZXTuneQT::Playlist::Scan::WATCH_FOLDERS, val);
+    return val != 0;
+  }
+
   const Time::Milliseconds UI_NOTIFICATION_PERIOD(500);
 
   class ProgressCallbackAdapter : public Log::ProgressCallback
@@ -348,6 +469,7 @@ namespace
     ScanRoutine(ScannerCallback& cb, Playlist::Item::DataProvider::Ptr provider)
       : Callback(cb)
       , Provider(std::move(provider))
+      , Incremental(false)
     {
       CreateQueue();
     }
@@ -359,11 +481,16 @@ namespace
 
     void Initialize() override
     {
+      Incremental = IsIncrementalScan();
       Callback.OnScanStart(Queue);
     }
 
     void Finalize() override
     {
+      if (Incremental)
+      {
+        Playlist::ScanIndex::Instance().Flush();
+      }
       Callback.OnScanEnd();
       CreateQueue();
     }
@@ -399,7 +526,7 @@ namespace
 
     void ScanFile(const QString& name, Log::ProgressCallback& cb)
     {
-      if (!ProcessAsPlaylist(name, cb))
+      if (!ProcessAsPlaylist(name, cb) && !OpenIndexedModules(name, cb))
       {
         DetectSubitems(name, cb);
       }
@@ -423,12 +550,61 @@ namespace
       return true;
     }
 
+    bool OpenIndexedModules(const QString& path, Log::ProgressCallback& cb)
+    {
+      QStringList modules;
+      QStringList types;
+      //data is cached by provider, so it's not read again in case of further detection
+      const auto content = [this, &path]() -> Binary::Data::Ptr
+      {
+        try
+        {
+          return Provider->GetData(FromQString(path));
+        }
+        catch (const Error&)
+        {
+          return Binary::Data::Ptr();
+        }
+      };
+      if (!Incremental || !Playlist::ScanIndex::Instance().Find(path, content, modules, types))
+      {
+        return false;
+      }
+      try
+      {
+        //pass nothing in case of error to avoid duplicates after fallback to detection
+        CollectingDetectParams params(cb);
+        //type is passed as plugin hint to avoid full detection
+        for (int idx = 0; idx != modules.size(); ++idx)
+        {
+          Provider->OpenModule(FromQString(modules[idx]), FromQString(types[idx]), params);
+        }
+        for (const auto& item : params.GetItems())
+        {
+          Callback.OnItem(item);
+        }
+        return true;
+      }
+      catch (const Error& e)
+      {
+        Dbg("Failed to open indexed modules of '%1%': %2%", FromQString(path), e.ToString());
+        return false;
+      }
+    }
+
     void DetectSubitems(const QString& itemPath, Log::ProgressCallback& cb)
     {
       try
       {
         DetectParamsAdapter params(Callback, cb);
         Provider->DetectModules(FromQString(itemPath), params);
+        if (Incremental)
+        {
+          if (const Binary::Data::Ptr content = params.GetContent())
+          {
+            Playlist::ScanIndex::Instance().Add(itemPath, *content, params.GetModules(), params.GetTypes());
+          }
+        }
       }
       catch (const Error& e)
       {
@@ -439,10 +615,12 @@ namespace
     ScannerCallback& Callback;
     const Playlist::Item::DataProvider::Ptr Provider;
     FilesQueue::Ptr Queue;
+    bool Incremental;
   };
 
   class ScannerImpl : public Playlist::Scanner
                     , private ScannerCallback
+                    , private Playlist::FoldersWatcher::Target
   {
   public:
     ScannerImpl(QObject& parent, Playlist::Item::DataProvider::Ptr provider)
@@ -450,6 +628,7 @@ namespace
       , Provider(provider)
       , Routine(MakePtr<ScanRoutine>(static_cast<ScannerCallback&>(*this), provider))
       , ScanJob(Async::CreateJob(Routine))
+      , Watcher(new Playlist::FoldersWatcher(*this, static_cast<Playlist::FoldersWatcher::Target&>(*this)))
     {
       Dbg("Created at %1%", this);
     }
@@ -464,6 +643,10 @@ namespace
       Dbg("Added %1% items to %2%", items.size(), this);
       Routine->Add(items);
       ScanJob->Start();
+      if (IsFoldersWatching())
+      {
+        Watcher->Watch(items);
+      }
     }
 
     void PasteItems(const QStringList& items) override
@@ -493,6 +676,13 @@ namespace
       ScanJob->Stop();
     }
   private:
+    void OnFilesAdded(const QStringList& files) override
+    {
+      //files only, so nothing to watch additionally
+      Routine->Add(files);
+      ScanJob->Start();
+    }
+
     void OnItem(Playlist::Item::Data::Ptr item) override
     {
       emit ItemFound(item);
@@ -531,6 +721,7 @@ namespace
     const Playlist::Item::DataProvider::Ptr Provider;
     const ScanRoutine::Ptr Routine;
     const Async::Job::Ptr ScanJob;
+    Playlist::FoldersWatcher* const Watcher;
   };
 }
 
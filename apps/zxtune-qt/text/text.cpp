@@ -54,6 +54,9 @@ extern const Char REPORT_BUG_URL[] = {
   'h','t','t','p','s',':','/','/','b','i','t','b','u','c','k','e','t','.','o','r','g','/','z','x','t','u','n',
   'e','/','z','x','t','u','n','e','/','i','s','s','u','e','s','/','n','e','w',0
 };
+extern const Char SCAN_INDEX_FILE[] = {
+  'Z','X','T','u','n','e','/','S','c','a','n','I','n','d','e','x','.','d','a','t',0
+};
 extern const Char TITLE_FORMAT[] = {
   '%','2','%',' ','[','%','1','%',']',0
 };
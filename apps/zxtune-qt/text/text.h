@@ -18,5 +18,6 @@ extern const Char PROGRAM_NAME[];
 extern const Char PROGRAM_SITE[];
 extern const Char PROJECT_NAME[];
 extern const Char REPORT_BUG_URL[];
+extern const Char SCAN_INDEX_FILE[];
 extern const Char TITLE_FORMAT[];
 }//namespace Text
@@ -153,9 +153,10 @@ namespace
         ShowPlaybackStatus(curFrame, state);
         if (Analyzer)
         {
-          const auto& curAnalyze = Analyzer->GetState();
+          AnalyzerState.clear();
+          Analyzer->GetState(AnalyzerState);
           AnalyzerData.resize(ScrSize.first);
-          UpdateAnalyzer(curAnalyze, 10);
+          UpdateAnalyzer(AnalyzerState, 10);
           ShowAnalyzer(spectrumHeight);
         }
       }
@@ -227,6 +228,7 @@ namespace
     Time::Microseconds FrameDuration;
     Module::TrackState::Ptr TrackState;
     Module::Analyzer::Ptr Analyzer;
+    std::vector<Module::Analyzer::ChannelState> AnalyzerState;
     std::vector<int_t> AnalyzerData;
   };
 }
@@ -284,6 +284,9 @@ namespace
       OptionDesc(Parameters::ZXTune::IO::Providers::File::OVERWRITE_EXISTING,
                  Text::INFO_OPTIONS_IO_PROVIDERS_FILE_OVERWRITE_EXISTING,
                  Parameters::ZXTune::IO::Providers::File::OVERWRITE_EXISTING_DEFAULT),
+      OptionDesc(Parameters::ZXTune::IO::Providers::File::WRITE_BUFFER_SIZE,
+                 Text::INFO_OPTIONS_IO_PROVIDERS_FILE_WRITE_BUFFER_SIZE,
+                 Parameters::ZXTune::IO::Providers::File::WRITE_BUFFER_SIZE_DEFAULT),
       //Sound parameters
       OptionDesc(Text::INFO_OPTIONS_SOUND_TITLE, EMPTY, 0),
       OptionDesc(Parameters::ZXTune::Sound::FREQUENCY,
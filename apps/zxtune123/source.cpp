@@ -46,6 +46,7 @@
 namespace
 {
   const Char DELIMITERS[] = {',', ';', ':', '\0'};
+  const std::size_t READ_AHEAD_FILES = 4;
 
   void OutputString(uint_t width, const String& text)
   {
@@ -235,9 +236,15 @@ namespace
 
     void ProcessItems(OnItemCallback& callback) override
     {
-      for (Strings::Array::const_iterator it = Files.begin(), lim = Files.end(); it != lim; ++it)
+      //hint several next files to be read while current one is processed
+      std::size_t prefetched = 1;
+      for (std::size_t idx = 0, lim = Files.size(); idx != lim; ++idx)
       {
-        ProcessItem(*it, callback);
+        for (; prefetched < lim && prefetched <= idx + READ_AHEAD_FILES; ++prefetched)
+        {
+          IO::PrefetchData(Files[prefetched]);
+        }
+        ProcessItem(Files[idx], callback);
       }
     }
   private:
@@ -542,6 +542,11 @@ extern const Char INFO_OPTIONS_IO_PROVIDERS_FILE_OVERWRITE_EXISTING[] = {
   'r','e','a','d','y',' ','e','x','i','s','t','s',' ','(','a','p','p','l','i','c','a','b','l','e',' ','f','o',
   'r',' ','f','o','r',' ','f','i','l','e','-','b','a','s','e','d',' ','b','a','c','k','e','n','d','s',')',0
 };
+extern const Char INFO_OPTIONS_IO_PROVIDERS_FILE_WRITE_BUFFER_SIZE[] = {
+  's','i','z','e',' ','o','f',' ','b','u','f','f','e','r',' ','f','o','r',' ','w','r','i','t','t','e','n',' ',
+  'd','a','t','a',' ','(','a','p','p','l','i','c','a','b','l','e',' ','f','o','r',' ','f','o','r',' ','f','i',
+  'l','e','-','b','a','s','e','d',' ','b','a','c','k','e','n','d','s',')',0
+};
 extern const Char INFO_OPTIONS_IO_PROVIDERS_TITLE[] = {
   ' ','I','O',' ','p','r','o','v','i','d','e','r','s',' ','o','p','t','i','o','n','s',':',0
 };
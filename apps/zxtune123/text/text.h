@@ -154,6 +154,7 @@ extern const Char INFO_OPTIONS_CORE_Z80_INT_TICKS[];
 extern const Char INFO_OPTIONS_IO_PROVIDERS_FILE_CREATE_DIRECTORIES[];
 extern const Char INFO_OPTIONS_IO_PROVIDERS_FILE_MMAP_THRESHOLD[];
 extern const Char INFO_OPTIONS_IO_PROVIDERS_FILE_OVERWRITE_EXISTING[];
+extern const Char INFO_OPTIONS_IO_PROVIDERS_FILE_WRITE_BUFFER_SIZE[];
 extern const Char INFO_OPTIONS_IO_PROVIDERS_TITLE[];
 extern const Char INFO_OPTIONS_SOUND_BACKENDS_ALSA_DEVICE[];
 extern const Char INFO_OPTIONS_SOUND_BACKENDS_ALSA_LATENCY[];
@@ -45,6 +45,11 @@ namespace Analysis
     };
 
     virtual void Scan(Binary::Container::Ptr source, Target& target) const = 0;
+
+    //! @brief Scan source reporting only data found at [reportFrom, reportTill) offsets
+    //! @note Used for windowed scanning of huge inputs. Window should be overlapped with neighbours
+    //!       by the maximal size of data to be found
+    virtual void Scan(Binary::Container::Ptr source, std::size_t reportFrom, std::size_t reportTill, Target& target) const = 0;
   };
 
   Scanner::RWPtr CreateScanner();
@@ -16,6 +16,7 @@
 #include <analysis/scanner.h>
 #include <debug/log.h>
 //std includes
+#include <algorithm>
 #include <deque>
 #include <list>
 
@@ -383,6 +384,69 @@ namespace Analysis
     Scanner::Target& Unrecognized;
   };
 
+  class RangeTarget : public Scanner::Target
+  {
+  public:
+    RangeTarget(std::size_t from, std::size_t till, Scanner::Target& delegate)
+      : From(from)
+      , Till(till)
+      , Delegate(delegate)
+    {
+    }
+
+    void Apply(const Archived::Decoder& decoder, std::size_t offset, Archived::Container::Ptr data) override
+    {
+      if (IsInRange(offset))
+      {
+        Delegate.Apply(decoder, offset, data);
+      }
+    }
+
+    void Apply(const Packed::Decoder& decoder, std::size_t offset, Packed::Container::Ptr data) override
+    {
+      if (IsInRange(offset))
+      {
+        Delegate.Apply(decoder, offset, data);
+      }
+    }
+
+    void Apply(const Image::Decoder& decoder, std::size_t offset, Image::Container::Ptr data) override
+    {
+      if (IsInRange(offset))
+      {
+        Delegate.Apply(decoder, offset, data);
+      }
+    }
+
+    void Apply(const Chiptune::Decoder& decoder, std::size_t offset, Chiptune::Container::Ptr data) override
+    {
+      if (IsInRange(offset))
+      {
+        Delegate.Apply(decoder, offset, data);
+      }
+    }
+
+    void Apply(std::size_t offset, Binary::Container::Ptr data) override
+    {
+      const std::size_t begin = std::max(offset, From);
+      const std::size_t end = std::min(offset + data->Size(), Till);
+      if (begin < end)
+      {
+        Dbg("Clip unrecognized %1%..%2% to %3%..%4%", offset, offset + data->Size(), begin, end);
+        Delegate.Apply(begin, data->GetSubcontainer(begin - offset, end - begin));
+      }
+    }
+  private:
+    bool IsInRange(std::size_t offset) const
+    {
+      return offset >= From && offset < Till;
+    }
+  private:
+    const std::size_t From;
+    const std::size_t Till;
+    Scanner::Target& Delegate;
+  };
+
   class LinearScanner : public Scanner
   {
   public:
@@ -416,6 +480,12 @@ namespace Analysis
 
       archived.Apply(0, data);
     }
+
+    void Scan(Binary::Container::Ptr data, std::size_t reportFrom, std::size_t reportTill, Target& target) const override
+    {
+      RangeTarget range(reportFrom, reportTill, target);
+      Scan(std::move(data), range);
+    }
   private:
     DecodersSet Decoders;
   };
@@ -18,6 +18,7 @@
 #include <async/activity.h>
 #include <async/progress.h>
 #include <async/sized_queue.h>
+#include <debug/metrics.h>
 //std includes
 #include <algorithm>
 #include <functional>
@@ -32,6 +33,7 @@ namespace Async
     DataReceiver(std::size_t workersCount, std::size_t queueSize, typename ::DataReceiver<T>::Ptr delegate)
       : QueueObject(SizedQueue<T>::Create(queueSize))
       , Statistic(Progress::Create())
+      , QueueDepth("zxtune_async_queue_depth")
       , Delegate(std::move(delegate))
     {
       StartAll(workersCount);
@@ -47,6 +49,7 @@ namespace Async
     {
       CheckWorkersAvailable();
       Statistic->Produce(1);
+      QueueDepth.Add(1);
       QueueObject->Add(std::move(data));
     }
 
@@ -67,7 +70,7 @@ namespace Async
   private:
     void StartAll(std::size_t count)
     {
-      const typename Operation::Ptr op = MakePtr<TransceiveOperation>(QueueObject, Statistic, Delegate);
+      const typename Operation::Ptr op = MakePtr<TransceiveOperation>(QueueObject, Statistic, QueueDepth, Delegate);
       while (Activities.size() < count)
       {
         const Activity::Ptr act = Activity::Create(op);
@@ -108,9 +111,10 @@ namespace Async
     class TransceiveOperation : public Operation
     {
     public:
-      TransceiveOperation(typename Queue<T>::Ptr queue, Progress::Ptr stat, typename DataReceiver<T>::Ptr target)
+      TransceiveOperation(typename Queue<T>::Ptr queue, Progress::Ptr stat, Debug::Metrics::Gauge depth, typename DataReceiver<T>::Ptr target)
         : QueueObject(std::move(queue))
         , Statistic(std::move(stat))
+        , QueueDepth(depth)
         , Target(std::move(target))
       {
       }
@@ -124,6 +128,7 @@ namespace Async
         T val;
         while (QueueObject->Get(val))
         {
+          QueueDepth.Add(-1);
           Target->ApplyData(std::move(val));
           Statistic->Consume(1);
         }
@@ -131,11 +136,13 @@ namespace Async
     private:
       const typename Queue<T>::Ptr QueueObject;
       const Progress::Ptr Statistic;
+      const Debug::Metrics::Gauge QueueDepth;
       const typename DataReceiver<T>::Ptr Target;
     };
   private:
     const typename Queue<T>::Ptr QueueObject;
     const Progress::Ptr Statistic;
+    const Debug::Metrics::Gauge QueueDepth;
     const typename ::DataReceiver<T>::Ptr Delegate;
     typedef std::list<typename Activity::Ptr> ActivitiesList;
     ActivitiesList Activities;
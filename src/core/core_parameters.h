@@ -23,6 +23,16 @@ namespace Parameters
       //! @brief Parameters#ZXTune#Core namespace prefix
       extern const NameType PREFIX;
 
+      //@{
+      //! @name Concurrent rendering of multichip devices (TurboSound, TurboFM)
+      const IntType PARALLEL_CHIPS_DISABLED = 0;
+      const IntType PARALLEL_CHIPS_ENABLED = 1;
+      //! Default is disabled
+      const IntType PARALLEL_CHIPS_DEFAULT = PARALLEL_CHIPS_DISABLED;
+      //! Parameter name
+      extern const NameType PARALLEL_CHIPS;
+      //@}
+
       //! @brief AYM-chip related parameters namespace
       namespace AYM
       {
@@ -55,6 +65,8 @@ namespace Parameters
         const IntType INTERPOLATION_NONE = 0;
         const IntType INTERPOLATION_LQ = 1;
         const IntType INTERPOLATION_HQ = 2;
+        //! HQ with sharper 4th order filter, opt-in since it's slower
+        const IntType INTERPOLATION_HQ_CASCADED = 3;
         //! Default is HQ
         const IntType INTERPOLATION_DEFAULT = INTERPOLATION_HQ;
         //! Parameter name
@@ -49,4 +49,10 @@ namespace Module
   //! @param callback Detect callback
   //! @throw Error if no module found
   void Open(const Parameters::Accessor& params, Binary::Container::Ptr data, const String& subpath, const DetectCallback& callback);
+
+  //! @brief Opens module directly from location using plugin it was detected by before
+  //! @param pluginId Identifier of plugin reported to DetectCallback (stored as Module::ATTR_TYPE), may be empty
+  //! @note Hinted plugin is tried first, all the plugins are probed only on its mismatch
+  //! @throw Error if no module found
+  void Open(const Parameters::Accessor& params, Binary::Container::Ptr data, const String& subpath, const String& pluginId, const DetectCallback& callback);
 }
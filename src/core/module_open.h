@@ -21,5 +21,9 @@ namespace Module
   //! @throw Error if no object detected
   Holder::Ptr Open(const Parameters::Accessor& params, Binary::Container::Ptr data, const String& subpath);
 
+  //! @param pluginId Identifier of plugin module was detected by before (Module::ATTR_TYPE), tried first. May be empty
+  //! @throw Error if no object detected
+  Holder::Ptr Open(const Parameters::Accessor& params, Binary::Container::Ptr data, const String& subpath, const String& pluginId);
+
   Holder::Ptr Open(const Parameters::Accessor& params, const Binary::Container& data);
 }
@@ -11,6 +11,7 @@
 //local includes
 #include "archived.h"
 #include <core/src/callback.h>
+#include <core/src/detection_metrics.h>
 #include <core/plugins/archive_plugins_enumerator.h>
 #include <core/plugins/archive_plugins_registrator.h>
 #include <core/plugins/player_plugins_enumerator.h>
@@ -25,6 +26,7 @@
 #include <core/plugin_attrs.h>
 #include <core/plugins_parameters.h>
 #include <debug/log.h>
+#include <debug/metrics.h>
 #include <l10n/api.h>
 #include <strings/prefixed_index.h>
 #include <time/duration.h>
@@ -686,8 +688,8 @@ namespace ZXTune
       {
         Time::Timer timer;
         const typename T::Ptr plugin = iter->Get();
-        const Analysis::Result::Ptr result = plugin->Detect(Params, input, callback);
         const String id = plugin->GetDescription()->Id();
+        const Analysis::Result::Ptr result = DetectBy(*plugin, input, callback);
         if (const std::size_t usedSize = result->GetMatchedDataSize())
         {
           Statistic::Self().AddAimed(*plugin, timer);
@@ -716,6 +718,13 @@ namespace ZXTune
       const std::size_t minLookahead = container.GetMinimalPluginLookahead();
       return Analysis::CreateUnmatchedResult(minLookahead);
     }
+
+    template<class T>
+    Analysis::Result::Ptr DetectBy(const T& plugin, DataLocation::Ptr input, const Module::DetectCallback& callback) const
+    {
+      const Debug::Metrics::Span span(GetDetectionTimeMetric(*plugin.GetDescription()));
+      return plugin.Detect(Params, std::move(input), callback);
+    }
   private:
     const Parameters::Accessor& Params;
     LookaheadPluginsStorage<PlayerPlugin> Players;
@@ -19,6 +19,7 @@
 #include <error.h>
 #include <make_ptr.h>
 //library includes
+#include <binary/container_factories.h>
 #include <binary/format_factories.h>
 #include <binary/compression/zlib_stream.h>
 #include <core/plugin_attrs.h>
@@ -39,6 +40,7 @@
 #include <sound/sound_parameters.h>
 #include <strings/optimize.h>
 //std includes
+#include <array>
 #include <map>
 //boost includes
 #include <boost/algorithm/string/predicate.hpp>
@@ -64,42 +66,75 @@ namespace GME
 
   typedef std::shared_ptr< ::Music_Emu> EmuPtr;
 
-  typedef EmuPtr (*EmuCreator)();
-  
-  template<class EmuType>
-  EmuPtr Create()
+  inline void CheckError(::blargg_err_t err)
   {
-    return EmuPtr(new EmuType());
+    if (err)
+    {
+      throw std::runtime_error(err);
+    }
   }
-  
-  class GME : public Module::Analyzer
+
+  //! Immutable loaded image shared between all the renderers of holder
+  class Image
   {
   public:
-    typedef std::shared_ptr<GME> Ptr;
-    
-    GME(EmuCreator create, Dump data, uint_t track)
-      : CreateEmu(create)
+    typedef std::shared_ptr<const Image> Ptr;
+
+    Image(::gme_type_t type, Binary::Data::Ptr data, uint_t track)
+      : Type(type)
       , Data(std::move(data))
       , Track(track)
-      , SoundFreq(0)
     {
-      const uint_t FAKE_SOUND_FREQUENCY = 30000;
-      Load(FAKE_SOUND_FREQUENCY);
     }
-    
-    uint_t GetTotalTracks() const
+
+    uint_t GetTrack() const
     {
-      return Emu->track_count();
+      return Track;
     }
-    
+
+    //! @brief Creates independent emulator instance
+    //! @note Data is not copied by emulators, so image should outlive them
+    EmuPtr CreateEmulator(uint_t soundFreq) const
+    {
+      const EmuPtr emu(Type->new_emu());
+      CheckError(emu->set_sample_rate(soundFreq));
+      Load(*emu);
+      return emu;
+    }
+
+    //! @brief Gets track metadata using lightweight info-only reader instead of emulator
     void GetInfo(::track_info_t& info) const
     {
-      CheckError(Emu->track_info(&info, Track));
+      const EmuPtr reader(Type->new_info());
+      Load(*reader);
+      CheckError(reader->track_info(&info, Track));
+    }
+  private:
+    void Load(::Music_Emu& emu) const
+    {
+      CheckError(emu.load_mem(Data->Start(), static_cast<long>(Data->Size())));
+    }
+  private:
+    const ::gme_type_t Type;
+    const Binary::Data::Ptr Data;
+    const uint_t Track;
+  };
+
+  //! Emulator state of single renderer
+  class GME : public Module::Analyzer
+  {
+  public:
+    typedef std::shared_ptr<GME> Ptr;
+    
+    explicit GME(Image::Ptr image)
+      : Source(std::move(image))
+      , SoundFreq(0)
+    {
     }
     
     void Reset()
     {
-      CheckError(Emu->start_track(Track));
+      CheckError(Emu->start_track(Source->GetTrack()));
     }
     
     void Render(uint_t samples, Sound::ChunkBuilder& target)
@@ -123,44 +158,30 @@ namespace GME
       }
     }
     
-    std::vector<ChannelState> GetState() const override
+    void GetState(std::vector<ChannelState>& result) const override
     {
-      std::vector<voice_status_t> voices(Emu->voice_count());
-      const int actual = Emu->voices_status(&voices[0], voices.size());
-      std::vector<ChannelState> result(actual);
+      if (!Emu)
+      {
+        return;
+      }
+      std::array<voice_status_t, MAX_VOICES> voices;
+      const int actual = Emu->voices_status(voices.data(), voices.size());
       for (int chan = 0; chan < actual; ++chan)
       {
         const voice_status_t& in = voices[chan];
         Devices::Details::AnalysisMap& analysis = GetAnalysisFor(in.frequency);
-        ChannelState& state = result[chan];
+        ChannelState state;
         state.Level = in.level * 100 / voice_max_level;
         state.Band = analysis.GetBandByPeriod(in.divider);
+        result.push_back(state);
       }
-      //required by compiler
-      return std::move(result);
     }
   private:
-    inline static void CheckError(::blargg_err_t err)
-    {
-      if (err)
-      {
-        throw std::runtime_error(err);
-      }
-    }
-
-    void Load(uint_t soundFreq)
-    {
-      auto emu = CreateEmu();
-      CheckError(emu->set_sample_rate(soundFreq));
-      CheckError(emu->load_mem(&Data.front(), Data.size()));
-      Emu.swap(emu);
-      SoundFreq = soundFreq;
-    }
-
     void Reload(uint_t soundFreq)
     {
       const auto oldPos = Emu ? Emu->tell() : 0;
-      Load(soundFreq);
+      Emu = Source->CreateEmulator(soundFreq);
+      SoundFreq = soundFreq;
       Reset();
       if (oldPos)
       {
@@ -175,9 +196,10 @@ namespace GME
       return result;
     }
   private:
-    const EmuCreator CreateEmu;
-    const Dump Data;
-    const uint_t Track;
+    //maximal voices count among all the supported emulators
+    static const std::size_t MAX_VOICES = 32;
+
+    const Image::Ptr Source;
     uint_t SoundFreq;
     EmuPtr Emu;
     mutable std::map<int, Devices::Details::AnalysisMap> Analysis;
@@ -285,11 +307,15 @@ namespace GME
     bool Looped;
   };
   
+  /*
+    Every renderer has its own emulator instance created from shared immutable image,
+    so several renderers of the same holder (e.g. subtunes of multitrack module) may work concurrently.
+  */
   class Holder : public Module::Holder
   {
   public:
-    Holder(GME::Ptr tune, Information::Ptr info, Parameters::Accessor::Ptr props)
-      : Tune(std::move(tune))
+    Holder(Image::Ptr image, Information::Ptr info, Parameters::Accessor::Ptr props)
+      : Tune(std::move(image))
       , Info(std::move(info))
       , Properties(std::move(props))
     {
@@ -309,7 +335,7 @@ namespace GME
     {
       try
       {
-        return MakePtr<Renderer>(Tune, Module::CreateStreamStateIterator(Info), target, params);
+        return MakePtr<Renderer>(MakePtr<GME>(Tune), Module::CreateStreamStateIterator(Info), target, params);
       }
       catch (const std::exception& e)
       {
@@ -317,34 +343,34 @@ namespace GME
       }
     }
   private:
-    const GME::Ptr Tune;
+    const Image::Ptr Tune;
     const Information::Ptr Info;
     const Parameters::Accessor::Ptr Properties;
   };
   
   //TODO: rework, extract GYM parsing code to Formats library
-  Dump DefaultDataCreator(const Binary::Data& data)
+  Binary::Data::Ptr DefaultDataCreator(Binary::Data::Ptr data)
   {
-    return Dump(static_cast<const uint8_t*>(data.Start()), static_cast<const uint8_t*>(data.Start()) + data.Size());
+    return data;
   }
   
-  using PlatformDetector = String (*)(const Dump&);
+  using PlatformDetector = String (*)(const Binary::Data&);
   
   struct PluginDescription
   {
     const Char* const Id;
     const uint_t ChiptuneCaps;
-    const EmuCreator CreateEmu;
+    const ::gme_type_t Type;
     const decltype(&DefaultDataCreator) CreateData;
     const PlatformDetector DetectPlatform;
   };
   
   namespace GYM
   {
-    Dump CreateData(const Binary::Data& data)
+    Binary::Data::Ptr CreateData(Binary::Data::Ptr data)
     {
-      Binary::DataInputStream input(data.Start(), data.Size());
-      Binary::DataBuilder output(data.Size());
+      Binary::DataInputStream input(data->Start(), data->Size());
+      Binary::DataBuilder output(data->Size());
       const std::size_t packedSizeOffset = 424;
       output.Add(input.ReadRawData(packedSizeOffset), packedSizeOffset);
       if (const auto packedSize = fromLE(input.ReadField<uint32_t>()))
@@ -358,18 +384,18 @@ namespace GME
         const auto rest = input.GetRestSize();
         output.Add(input.ReadRawData(rest), rest);
       }
-      Dump result;
-      output.CaptureResult(result);
-      return result;
+      std::unique_ptr<Dump> result(new Dump());
+      output.CaptureResult(*result);
+      return Binary::CreateContainer(std::move(result));
     }
   }
  
   const Time::Milliseconds PERIOD(20);
   
-  Time::Milliseconds GetProperties(const GME& gme, PropertiesHelper& props)
+  Time::Milliseconds GetProperties(const Image& image, PropertiesHelper& props)
   {
     ::track_info_t info;
-    gme.GetInfo(info);
+    image.GetInfo(info);
     
     const auto system = Strings::OptimizeAscii(info.system);
     const auto song = Strings::OptimizeAscii(info.song);
@@ -424,16 +450,16 @@ namespace GME
           }
 
           PropertiesHelper props(*properties);
-          auto data = Desc.CreateData(*container);
-          props.SetPlatform(Desc.DetectPlatform(data));
-          const GME::Ptr tune = MakePtr<GME>(Desc.CreateEmu, std::move(data), container->StartTrackIndex());
-          const Time::Milliseconds storedDuration = GetProperties(*tune, props);
+          const auto data = Desc.CreateData(container);
+          props.SetPlatform(Desc.DetectPlatform(*data));
+          const Image::Ptr image = MakePtr<Image>(Desc.Type, data, container->StartTrackIndex());
+          const Time::Milliseconds storedDuration = GetProperties(*image, props);
           const Time::Milliseconds duration = storedDuration == Time::Milliseconds() ? Time::Milliseconds(GetDuration(params)) : storedDuration;
           const Information::Ptr info = CreateStreamInfo(duration.Get() / PERIOD.Get());
         
           props.SetSource(*Formats::Chiptune::CreateMultitrackChiptuneContainer(container));
         
-          return MakePtr<Holder>(tune, info, properties);
+          return MakePtr<Holder>(image, info, properties);
         }
       }
       catch (const std::exception& e)
@@ -470,16 +496,16 @@ namespace GME
         if (const Formats::Chiptune::Container::Ptr container = Decoder->Decode(rawData))
         {
           PropertiesHelper props(*properties);
-          auto data = Desc.CreateData(*container);
-          props.SetPlatform(Desc.DetectPlatform(data));
-          const GME::Ptr tune = MakePtr<GME>(Desc.CreateEmu, std::move(data), 0);
-          const Time::Milliseconds storedDuration = GetProperties(*tune, props);
+          const auto data = Desc.CreateData(container);
+          props.SetPlatform(Desc.DetectPlatform(*data));
+          const Image::Ptr image = MakePtr<Image>(Desc.Type, data, 0);
+          const Time::Milliseconds storedDuration = GetProperties(*image, props);
           const Time::Milliseconds duration = storedDuration == Time::Milliseconds() ? Time::Milliseconds(GetDuration(params)) : storedDuration;
           const Information::Ptr info = CreateStreamInfo(duration.Get() / PERIOD.Get());
         
           props.SetSource(*container);
         
-          return MakePtr<Holder>(tune, info, properties);
+          return MakePtr<Holder>(image, info, properties);
         }
       }
       catch (const std::exception& e)
@@ -510,9 +536,9 @@ namespace GME
       {
         "NSF",
         ZXTune::Capabilities::Module::Type::MEMORYDUMP | ZXTune::Capabilities::Module::Device::RP2A0X,
-        &Create< ::Nsf_Emu>,
+        ::gme_nsf_type,
         &DefaultDataCreator,
-        [](const Dump&) -> String {return Platforms::NINTENDO_ENTERTAINMENT_SYSTEM;}
+        [](const Binary::Data&) -> String {return Platforms::NINTENDO_ENTERTAINMENT_SYSTEM;}
       },
       &Formats::Multitrack::CreateNSFDecoder,
       &Formats::Chiptune::CreateNSFDecoder,
@@ -522,9 +548,9 @@ namespace GME
       {
         "NSFE",
         ZXTune::Capabilities::Module::Type::MEMORYDUMP | ZXTune::Capabilities::Module::Device::RP2A0X,
-        &Create< ::Nsfe_Emu>,
+        ::gme_nsfe_type,
         &DefaultDataCreator,
-        [](const Dump&) -> String {return Platforms::NINTENDO_ENTERTAINMENT_SYSTEM;}
+        [](const Binary::Data&) -> String {return Platforms::NINTENDO_ENTERTAINMENT_SYSTEM;}
       },
       &Formats::Multitrack::CreateNSFEDecoder,
       &Formats::Chiptune::CreateNSFEDecoder,
@@ -534,9 +560,9 @@ namespace GME
       {
         "GBS",
         ZXTune::Capabilities::Module::Type::MEMORYDUMP | ZXTune::Capabilities::Module::Device::LR35902,
-        &Create< ::Gbs_Emu>,
+        ::gme_gbs_type,
         &DefaultDataCreator,
-        [](const Dump&) -> String {return Platforms::GAME_BOY;}
+        [](const Binary::Data&) -> String {return Platforms::GAME_BOY;}
       },
       &Formats::Multitrack::CreateGBSDecoder,
       &Formats::Chiptune::CreateGBSDecoder,
@@ -546,7 +572,7 @@ namespace GME
       {
         "KSSX",
         ZXTune::Capabilities::Module::Type::MEMORYDUMP | ZXTune::Capabilities::Module::Device::MULTI,
-        &Create< ::Kss_Emu>,
+        ::gme_kss_type,
         &DefaultDataCreator,
         &KSS::DetectPlatform
       },
@@ -558,9 +584,9 @@ namespace GME
       {
         "HES",
         ZXTune::Capabilities::Module::Type::MEMORYDUMP | ZXTune::Capabilities::Module::Device::HUC6270,
-        &Create< ::Hes_Emu>,
+        ::gme_hes_type,
         &DefaultDataCreator,
-        [](const Dump&) -> String {return Platforms::PC_ENGINE;}
+        [](const Binary::Data&) -> String {return Platforms::PC_ENGINE;}
       },
       &Formats::Multitrack::CreateHESDecoder,
       &Formats::Chiptune::CreateHESDecoder
@@ -582,7 +608,7 @@ namespace GME
       {
         "VGM",
         ZXTune::Capabilities::Module::Type::STREAM | ZXTune::Capabilities::Module::Device::MULTI,
-        &Create< ::Vgm_Emu>,
+        ::gme_vgm_type,
         &DefaultDataCreator,
         &VGM::DetectPlatform
       },
@@ -593,9 +619,9 @@ namespace GME
       {
         "GYM",
         ZXTune::Capabilities::Module::Type::STREAM | ZXTune::Capabilities::Module::Device::MULTI,
-        &Create< ::Gym_Emu>,
+        ::gme_gym_type,
         &GYM::CreateData,
-        [](const Dump&) -> String {return Platforms::SEGA_GENESIS;}
+        [](const Binary::Data&) -> String {return Platforms::SEGA_GENESIS;}
       },
       &Formats::Chiptune::CreateGYMDecoder
     },
@@ -604,7 +630,7 @@ namespace GME
       {
         "KSS",
         ZXTune::Capabilities::Module::Type::MEMORYDUMP | ZXTune::Capabilities::Module::Device::MULTI,
-        &Create< ::Kss_Emu>,
+        ::gme_kss_type,
         &DefaultDataCreator,
         &KSS::DetectPlatform
       },
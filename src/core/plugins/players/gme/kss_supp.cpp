@@ -10,6 +10,8 @@
 
 //local includes
 #include "kss_supp.h"
+//common includes
+#include <contract.h>
 //text includes
 #include <module/text/platforms.h>
 
@@ -17,10 +19,11 @@ namespace Module
 {
   namespace KSS
   {
-    String DetectPlatform(const Dump& data)
+    String DetectPlatform(const Binary::Data& data)
     {
       //do not check signatures or other
-      const auto deviceFlag = data.at(0x0f);
+      Require(data.Size() > 0x0f);
+      const auto deviceFlag = static_cast<const uint8_t*>(data.Start())[0x0f];
       const bool sn76489 = deviceFlag & 2;
       if (sn76489)
       {
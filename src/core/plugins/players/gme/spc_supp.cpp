@@ -91,12 +91,11 @@ namespace SPC
     }
     
     //http://wiki.superfamicom.org/snes/show/SPC700+Reference
-    std::vector<ChannelState> GetState() const override
+    void GetState(std::vector<ChannelState>& result) const override
     {
       const DspProperties dsp(Spc);
       const uint_t noise = dsp.GetNoiseChannels();
       const uint_t active = dsp.GetToneChannels() | noise;
-      std::vector<ChannelState> result;
       const uint_t noisePitch = noise != 0
         ? dsp.GetNoisePitch()
         : 0;
@@ -117,7 +116,6 @@ namespace SPC
         state.Band = Analysis.GetBandByScaledFrequency(pitch);
         result.push_back(state);
       }
-      return result;
     }
   private:
     inline static void CheckError(::blargg_err_t err)
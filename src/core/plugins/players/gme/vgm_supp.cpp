@@ -408,8 +408,8 @@ namespace Module
     class PlatformDetector
     {
     public:
-      explicit PlatformDetector(const Dump& data)
-        : Input(data.data(), data.size())
+      explicit PlatformDetector(const Binary::Data& data)
+        : Input(data.Start(), data.Size())
       {
         Input.Seek(0x8);
         const auto vers = Input.ReadRawData(4);
@@ -958,7 +958,7 @@ namespace Module
       std::map<uint_t, DeviceTraits> Traits;
     };
     
-    String DetectPlatform(const Dump& data)
+    String DetectPlatform(const Binary::Data& data)
     {
       PlatformDetector detector(data);
       return detector.GetResult();
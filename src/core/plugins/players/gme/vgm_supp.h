@@ -12,11 +12,13 @@
 
 //common includes
 #include <types.h>
+//library includes
+#include <binary/data.h>
 
 namespace Module
 {
   namespace VGM
   {
-    String DetectPlatform(const Dump& blob);
+    String DetectPlatform(const Binary::Data& blob);
   }
 }
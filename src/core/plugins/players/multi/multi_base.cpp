@@ -36,21 +36,15 @@ namespace Module
   public:
     explicit MultiAnalyzer(AnalyzersArray delegates)
       : Delegates(std::move(delegates))
-      , MaxBands(4 * Delegates.size())//approx
     {
     }
 
-    std::vector<ChannelState> GetState() const override
+    void GetState(std::vector<ChannelState>& result) const override
     {
-      std::vector<ChannelState> result;
-      result.reserve(MaxBands);
       for (const auto& delegate : Delegates)
       {
-        const auto& portion = delegate->GetState();
-        std::copy(portion.begin(), portion.end(), std::back_inserter(result));
+        delegate->GetState(result);
       }
-      MaxBands = std::max(MaxBands, result.size());
-      return result;
     }
     
     static Ptr Create(const RenderersArray& renderers)
@@ -63,7 +57,6 @@ namespace Module
     }
   private:
     const AnalyzersArray Delegates;
-    mutable std::size_t MaxBands;
   };
  
   class MultiInformation : public Information
@@ -76,19 +76,17 @@ namespace Sid
       Analysis.SetClockAndDivisor(rate, 16777216);
     }
 
-    std::vector<ChannelState> GetState() const override
+    void GetState(std::vector<ChannelState>& result) const override
     {
       unsigned freqs[6], levels[6];
       const unsigned count = Engine->getState(freqs, levels);
-      std::vector<ChannelState> result(count);
       for (uint_t chan = 0; chan != count; ++chan)
       {
-        ChannelState& res = result[chan];
+        ChannelState res;
         res.Band = Analysis.GetBandByScaledFrequency(freqs[chan]);
         res.Level = levels[chan] * 100 / 15;
+        result.push_back(res);
       }
-      //required for compiler...
-      return std::move(result);
     }
   private:
     const EnginePtr Engine;
@@ -14,6 +14,7 @@
 //common includes
 #include <make_ptr.h>
 //library includes
+#include <core/core_parameters.h>
 #include <core/plugin_attrs.h>
 #include <module/players/tfm/tfm_base.h>
 #include <module/players/tfm/tfm_parameters.h>
@@ -43,7 +44,11 @@ namespace Module
     Renderer::Ptr CreateRenderer(Parameters::Accessor::Ptr params, Sound::Receiver::Ptr target) const override
     {
       const Devices::TFM::ChipParameters::Ptr chipParams = TFM::CreateChipParameters(params);
-      const Devices::TFM::Chip::Ptr chip = Devices::TFM::CreateChip(chipParams, target);
+      Parameters::IntType parallel = Parameters::ZXTune::Core::PARALLEL_CHIPS_DEFAULT;
+      params->FindValue(Parameters::ZXTune::Core::PARALLEL_CHIPS, parallel);
+      const Devices::TFM::Chip::Ptr chip = parallel != Parameters::ZXTune::Core::PARALLEL_CHIPS_DISABLED
+        ? Devices::TFM::CreateParallelChip(chipParams, target)
+        : Devices::TFM::CreateChip(chipParams, target);
       const Sound::RenderParameters::Ptr soundParams = Sound::RenderParameters::Create(params);
       const TFM::DataIterator::Ptr iterator = Tune->CreateDataIterator();
       return TFM::CreateRenderer(soundParams, iterator, chip);
@@ -246,12 +246,10 @@ namespace Xmp
     {
     }
 
-    std::vector<ChannelState> GetState() const override
+    void GetState(std::vector<ChannelState>& result) const override
     {
       //difference between libxmp and regular spectrum formats is 2 octaves
       const int C2OFFSET = 24;
-      std::vector<ChannelState> result;
-      result.reserve(Channels);
       ChannelState chan;
       for (uint_t idx = 0; idx != Channels; ++idx)
       {
@@ -265,7 +263,6 @@ namespace Xmp
           result.push_back(chan);
         }
       }
-      return result;
     }
   private:
     const uint_t Channels;
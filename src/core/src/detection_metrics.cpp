@@ -0,0 +1,60 @@
+/**
+* 
+* @file
+*
+* @brief  Plugins detection metrics implementation
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+//local includes
+#include "detection_metrics.h"
+//std includes
+#include <unordered_map>
+
+namespace
+{
+  //plugins set is fixed, so lookups do not require locking
+  class DetectionMetrics
+  {
+  public:
+    static const DetectionMetrics& Instance()
+    {
+      static const DetectionMetrics self;
+      return self;
+    }
+
+    const Debug::Metrics::Histogram& Get(const ZXTune::Plugin& description) const
+    {
+      const auto it = Histograms.find(&description);
+      return it != Histograms.end() ? it->second : Stub;
+    }
+  private:
+    DetectionMetrics()
+      : Stub(std::string())
+    {
+      if (!Debug::Metrics::IsEnabled())
+      {
+        return;
+      }
+      const Debug::Metrics::HistogramFamily family("zxtune_detection_duration_seconds", "plugin");
+      for (const auto plugins = ZXTune::EnumeratePlugins(); plugins->IsValid(); plugins->Next())
+      {
+        const ZXTune::Plugin::Ptr plugin = plugins->Get();
+        Histograms.emplace(plugin.get(), family.Get(plugin->Id()));
+      }
+    }
+  private:
+    const Debug::Metrics::Histogram Stub;
+    std::unordered_map<const ZXTune::Plugin*, Debug::Metrics::Histogram> Histograms;
+  };
+}
+
+namespace ZXTune
+{
+  const Debug::Metrics::Histogram& GetDetectionTimeMetric(const Plugin& description)
+  {
+    return DetectionMetrics::Instance().Get(description);
+  }
+}
@@ -0,0 +1,21 @@
+/**
+* 
+* @file
+*
+* @brief  Plugins detection metrics
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+#pragma once
+
+//library includes
+#include <core/plugin.h>
+#include <debug/metrics.h>
+
+namespace ZXTune
+{
+  //! @brief Detection time histogram of plugin, resolved once for all the plugins
+  const Debug::Metrics::Histogram& GetDetectionTimeMetric(const Plugin& description);
+}
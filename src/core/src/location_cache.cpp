@@ -0,0 +1,195 @@
+/**
+*
+* @file
+*
+* @brief  Resolved nested locations cache implementation
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+//local includes
+#include "location_cache.h"
+#include "location.h"
+//common includes
+#include <make_ptr.h>
+//library includes
+#include <debug/log.h>
+#include <debug/metrics.h>
+//std includes
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace
+{
+  const Debug::Stream Dbg("Core::LocationsCache");
+}
+
+namespace ZXTune
+{
+  class LimitedResolvedLocationsCache : public ResolvedLocationsCache
+  {
+  public:
+    LimitedResolvedLocationsCache(std::size_t maxSources, std::size_t maxSize)
+      : MaxSources(maxSources)
+      , MaxSize(maxSize)
+      , HitsMetric("zxtune_location_cache_hits_total")
+      , MissesMetric("zxtune_location_cache_misses_total")
+      , Size()
+    {
+    }
+
+    DataLocation::Ptr Find(const Binary::Container::Ptr& data, const Analysis::Path& path) override
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      DropExpiredSources();
+      DataLocation::Ptr result;
+      if (const auto source = FindSource(data))
+      {
+        const Node* node = &source->Root;
+        for (const auto elements = path.GetIterator(); node && elements->IsValid(); elements->Next())
+        {
+          const auto it = node->Children.find(elements->Get());
+          node = it != node->Children.end() ? it->second.get() : nullptr;
+          if (node && node->Location)
+          {
+            result = node->Location;
+          }
+        }
+      }
+      if (result)
+      {
+        HitsMetric.Add();
+      }
+      else
+      {
+        MissesMetric.Add();
+      }
+      return result;
+    }
+
+    void Add(const Binary::Container::Ptr& data, const DataLocation& location) override
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      DropExpiredSources();
+      auto source = FindSource(data);
+      if (!source)
+      {
+        Sources.emplace_front(data);
+        source = &Sources.front();
+      }
+      //iterator does not own path
+      const auto path = location.GetPath();
+      Node* node = &source->Root;
+      for (const auto elements = path->GetIterator(); elements->IsValid(); elements->Next())
+      {
+        auto& child = node->Children[elements->Get()];
+        if (!child)
+        {
+          child.reset(new Node());
+        }
+        node = child.get();
+      }
+      const auto nestedData = location.GetData();
+      const std::size_t oldSize = node->Location ? node->Location->GetData()->Size() : 0;
+      const std::size_t newSize = nestedData->Size();
+      //detached from parent locations to not to keep source container alive
+      node->Location = CreateLocation(nestedData, location.GetPluginsChain()->AsString(), path->AsString());
+      source->Size = source->Size - oldSize + newSize;
+      Size = Size - oldSize + newSize;
+      while (!Sources.empty() && (Sources.size() > MaxSources || Size > MaxSize))
+      {
+        Dbg("Drop cached locations of source with %1% bytes decoded", Sources.back().Size);
+        DropSource(std::prev(Sources.end()));
+      }
+    }
+
+    std::size_t GetSize() const override
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      return Size;
+    }
+  private:
+    struct Node
+    {
+      DataLocation::Ptr Location;
+      std::map<String, std::unique_ptr<Node> > Children;
+    };
+
+    struct Source
+    {
+      explicit Source(const Binary::Container::Ptr& data)
+        : Data(data)
+        , Key(data.get())
+        , Size()
+      {
+      }
+
+      bool Matches(const Binary::Container::Ptr& data) const
+      {
+        //weak reference keeps control block alive, so key cannot be reused by another object
+        return Key == data.get() && !Data.owner_before(data) && !data.owner_before(Data);
+      }
+
+      const std::weak_ptr<const Binary::Container> Data;
+      const Binary::Container* const Key;
+      Node Root;
+      std::size_t Size;
+    };
+
+    typedef std::list<Source> SourcesList;
+
+    Source* FindSource(const Binary::Container::Ptr& data)
+    {
+      for (auto it = Sources.begin(), lim = Sources.end(); it != lim; ++it)
+      {
+        if (it->Matches(data))
+        {
+          Sources.splice(Sources.begin(), Sources, it);
+          return &Sources.front();
+        }
+      }
+      return nullptr;
+    }
+
+    void DropExpiredSources()
+    {
+      for (auto it = Sources.begin(); it != Sources.end();)
+      {
+        it = it->Data.expired() ? DropSource(it) : std::next(it);
+      }
+    }
+
+    SourcesList::iterator DropSource(SourcesList::iterator it)
+    {
+      Size -= it->Size;
+      return Sources.erase(it);
+    }
+  private:
+    const std::size_t MaxSources;
+    const std::size_t MaxSize;
+    const Debug::Metrics::Counter HitsMetric;
+    const Debug::Metrics::Counter MissesMetric;
+    mutable std::mutex Guard;
+    SourcesList Sources;
+    std::size_t Size;
+  };
+
+  ResolvedLocationsCache::Ptr ResolvedLocationsCache::Create(std::size_t maxSources, std::size_t maxSize)
+  {
+    return MakePtr<LimitedResolvedLocationsCache>(maxSources, maxSize);
+  }
+
+  ResolvedLocationsCache& ResolvedLocationsCache::Instance()
+  {
+    //most recently used sources are kept to survive interleaved access (e.g. scanning while playing)
+    static const std::size_t MAX_SOURCES = 4;
+    //limit for summary size of decoded data kept for all the sources
+    static const std::size_t MAX_SIZE = 64 << 20;
+    static const Ptr instance = Create(MAX_SOURCES, MAX_SIZE);
+    return *instance;
+  }
+}
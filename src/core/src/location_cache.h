@@ -0,0 +1,45 @@
+/**
+*
+* @file
+*
+* @brief  Resolved nested locations cache
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+#pragma once
+
+//library includes
+#include <core/data_location.h>
+
+namespace ZXTune
+{
+  /*
+    Resolved nested locations of the most recently used sources, indexed by path elements.
+    Entries of the same container (e.g. playlist items from single disk image) share already
+    decoded ancestors, so only the rest of the subpath is resolved.
+    Cached locations do not refer source container, so its owner (e.g. data provider) defines
+    the lifetime: locations of the destroyed sources are dropped.
+    Parameters used to resolve locations are not a part of the key: subpath specifies the
+    nested data unambiguously, parameters may only affect detection speed.
+  */
+  class ResolvedLocationsCache
+  {
+  public:
+    typedef std::shared_ptr<ResolvedLocationsCache> Ptr;
+    virtual ~ResolvedLocationsCache() = default;
+
+    //! @return Deepest cached location for @p path prefix, null if nothing found
+    virtual DataLocation::Ptr Find(const Binary::Container::Ptr& data, const Analysis::Path& path) = 0;
+    virtual void Add(const Binary::Container::Ptr& data, const DataLocation& location) = 0;
+    //! @return Summary size of decoded data kept in cache
+    virtual std::size_t GetSize() const = 0;
+
+    //! @param maxSources Count of the most recently used sources to keep
+    //! @param maxSize Limit for summary size of decoded data of all the sources
+    static Ptr Create(std::size_t maxSources, std::size_t maxSize);
+    //! @brief Process-wide instance used to open locations
+    static ResolvedLocationsCache& Instance();
+  };
+}
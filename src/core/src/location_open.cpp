@@ -10,6 +10,7 @@
 
 //local includes
 #include "location.h"
+#include "location_cache.h"
 #include "core/plugins/archive_plugins_enumerator.h"
 //common includes
 #include <error_tools.h>
@@ -118,10 +119,26 @@ namespace ZXTune
 
   DataLocation::Ptr OpenLocation(const Parameters::Accessor& params, Binary::Container::Ptr data, const String& subpath)
   {
-    const ArchivePluginsEnumerator::Ptr usedPlugins = ArchivePluginsEnumerator::Create();
-    DataLocation::Ptr resolvedLocation = MakePtr<UnresolvedLocation>(data);
     const Analysis::Path::Ptr sourcePath = Analysis::ParsePath(subpath, Text::MODULE_SUBPATH_DELIMITER[0]);
-    for (Analysis::Path::Ptr unresolved = sourcePath; !unresolved->Empty(); unresolved = sourcePath->Extract(resolvedLocation->GetPath()->AsString()))
+    if (sourcePath->Empty())
+    {
+      return MakePtr<UnresolvedLocation>(data);
+    }
+    auto& cache = ResolvedLocationsCache::Instance();
+    DataLocation::Ptr resolvedLocation = cache.Find(data, *sourcePath);
+    Analysis::Path::Ptr unresolved = sourcePath;
+    if (resolvedLocation)
+    {
+      const String resolved = resolvedLocation->GetPath()->AsString();
+      Dbg("Use cached '%1%'", resolved);
+      unresolved = sourcePath->Extract(resolved);
+    }
+    else
+    {
+      resolvedLocation = MakePtr<UnresolvedLocation>(data);
+    }
+    const ArchivePluginsEnumerator::Ptr usedPlugins = ArchivePluginsEnumerator::Create();
+    for (; !unresolved->Empty(); unresolved = sourcePath->Extract(resolvedLocation->GetPath()->AsString()))
     {
       const String toResolve = unresolved->AsString();
       Dbg("Resolving '%1%'", toResolve);
@@ -129,6 +146,7 @@ namespace ZXTune
       {
         throw MakeFormattedError(THIS_LINE, translate("Failed to resolve subpath '%1%'."), subpath);
       }
+      cache.Add(data, *resolvedLocation);
     }
     Dbg("Resolved '%1%'", subpath);
     return resolvedLocation;
@@ -10,6 +10,7 @@
 
 //local includes
 #include "callback.h"
+#include "detection_metrics.h"
 #include "core/additional_files_resolve.h"
 #include "core/plugin_attrs.h"
 #include "core/plugins/archive_plugins_enumerator.h"
@@ -20,6 +21,7 @@
 #include <make_ptr.h>
 //library includes
 #include <debug/log.h>
+#include <debug/metrics.h>
 #include <l10n/api.h>
 #include <module/players/aym/aym_base.h>
 #include <parameters/merged_accessor.h>
@@ -70,13 +72,20 @@ namespace Module
     mutable Holder::Ptr Result;
   };
   
+  template<class T>
+  Analysis::Result::Ptr DetectWithPlugin(const T& plugin, const Parameters::Accessor& params, ZXTune::DataLocation::Ptr location, const DetectCallback& callback)
+  {
+    const Debug::Metrics::Span span(ZXTune::GetDetectionTimeMetric(*plugin.GetDescription()));
+    return plugin.Detect(params, std::move(location), callback);
+  }
+
   template<class T>
   std::size_t DetectByPlugins(const Parameters::Accessor& params, typename T::Iterator::Ptr plugins, ZXTune::DataLocation::Ptr location, const DetectCallback& callback)
   {
     for (; plugins->IsValid(); plugins->Next())
     {
       const typename T::Ptr plugin = plugins->Get();
-      const Analysis::Result::Ptr result = plugin->Detect(params, location, callback);
+      const Analysis::Result::Ptr result = DetectWithPlugin(*plugin, params, location, callback);
       if (std::size_t usedSize = result->GetMatchedDataSize())
       {
         Dbg("Detected %1% in %2% bytes at %3%.", plugin->GetDescription()->Id(), usedSize, location->GetPath()->AsString());
@@ -266,23 +275,87 @@ namespace Module
     return DetectByPlugins<PlayerPlugin>(params, usedPlayerPlugins->Enumerate(), location, callback);
   }
 
-  void Open(const Parameters::Accessor& params, Binary::Container::Ptr data, const String& subpath, const DetectCallback& callback)
+  class PluginHintStatistic
+  {
+  public:
+    static const PluginHintStatistic& Instance()
+    {
+      static const PluginHintStatistic instance;
+      return instance;
+    }
+
+    const Debug::Metrics::Counter Hits;
+    const Debug::Metrics::Counter Misses;
+  private:
+    PluginHintStatistic()
+      : Hits("zxtune_open_plugin_hint_hits_total")
+      , Misses("zxtune_open_plugin_hint_misses_total")
+    {
+    }
+  };
+
+  ZXTune::PlayerPlugin::Ptr FindPlayerPlugin(const String& id)
+  {
+    using namespace ZXTune;
+    for (const auto plugins = PlayerPluginsEnumerator::Create()->Enumerate(); plugins->IsValid(); plugins->Next())
+    {
+      const auto plugin = plugins->Get();
+      if (plugin->GetDescription()->Id() == id)
+      {
+        return plugin;
+      }
+    }
+    return PlayerPlugin::Ptr();
+  }
+
+  std::size_t OpenInternal(const Parameters::Accessor& params, ZXTune::DataLocation::Ptr location, const String& pluginId, const DetectCallback& callback)
+  {
+    if (pluginId.empty())
+    {
+      return OpenInternal(params, location, callback);
+    }
+    const auto& statistic = PluginHintStatistic::Instance();
+    if (const auto plugin = FindPlayerPlugin(pluginId))
+    {
+      const auto result = DetectWithPlugin(*plugin, params, location, callback);
+      if (const std::size_t usedSize = result->GetMatchedDataSize())
+      {
+        statistic.Hits.Add();
+        return usedSize;
+      }
+    }
+    Dbg("Plugin hint %1% mismatched at %2%, fallback to full scan", pluginId, location->GetPath()->AsString());
+    statistic.Misses.Add();
+    return OpenInternal(params, location, callback);
+  }
+
+  void Open(const Parameters::Accessor& params, Binary::Container::Ptr data, const String& subpath, const String& pluginId, const DetectCallback& callback)
   {
     const ResolveAdditionalFilesAdapter adapter(params, data, callback);
     const auto location = ZXTune::OpenLocation(params, data, subpath);
-    if (!OpenInternal(params, location, adapter))
+    if (!OpenInternal(params, location, pluginId, adapter))
     {
       throw Error(THIS_LINE, translate("Failed to find module at specified location."));
     }
   }
+
+  void Open(const Parameters::Accessor& params, Binary::Container::Ptr data, const String& subpath, const DetectCallback& callback)
+  {
+    Open(params, std::move(data), subpath, String(), callback);
+  }
   
-  Holder::Ptr Open(const Parameters::Accessor& params, Binary::Container::Ptr data, const String& subpath)
+  Holder::Ptr Open(const Parameters::Accessor& params, Binary::Container::Ptr data, const String& subpath, const String& pluginId)
   {
     const OpenModuleCallback callback;
-    Open(params, data, subpath, callback);
+    Open(params, std::move(data), subpath, pluginId, callback);
     return callback.GetResult();
   }
 
+  Holder::Ptr Open(const Parameters::Accessor& params, Binary::Container::Ptr data, const String& subpath)
+  {
+    return Open(params, std::move(data), subpath, String());
+  }
+
   Holder::Ptr Open(const Parameters::Accessor& params, const Binary::Container& data)
   {
     using namespace ZXTune;
@@ -21,6 +21,8 @@ namespace Parameters
     {
       extern const NameType PREFIX = ZXTune::PREFIX + "core";
 
+      extern const NameType PARALLEL_CHIPS = PREFIX + "parallel_chips";
+
       namespace AYM
       {
         extern const NameType PREFIX = Core::PREFIX + "aym";
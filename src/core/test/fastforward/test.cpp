@@ -0,0 +1,130 @@
+/**
+* 
+* @file
+*
+* @brief  Fast-forward test
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+#include <error_tools.h>
+#include <make_ptr.h>
+#include <progress_callback.h>
+#include <core/module_open.h>
+#include <devices/aym.h>
+#include <io/api.h>
+#include <module/fast_forward.h>
+#include <module/players/aym/aym_base.h>
+#include <parameters/container.h>
+#include <iostream>
+
+#define FILE_TAG 6A1C0F53
+
+namespace
+{
+  typedef std::array<uint_t, Devices::AYM::Registers::TOTAL> RegistersState;
+
+  class RegistersDump : public Devices::AYM::Device
+  {
+  public:
+    RegistersDump()
+      : State()
+    {
+    }
+
+    void RenderData(const Devices::AYM::DataChunk& src) override
+    {
+      for (Devices::AYM::Registers::IndicesIterator it(src.Data); it; ++it)
+      {
+        State[*it] = src.Data[*it];
+      }
+    }
+
+    void RenderData(const std::vector<Devices::AYM::DataChunk>& src) override
+    {
+      for (const auto& chunk : src)
+      {
+        RenderData(chunk);
+      }
+    }
+
+    void Reset() override
+    {
+      State = RegistersState();
+    }
+
+    RegistersState State;
+  };
+
+  Module::AYM::Holder::Ptr OpenModuleByPath(const String& fullPath, const String& subpath)
+  {
+    const Parameters::Container::Ptr emptyParams = Parameters::Container::Create();
+    const Binary::Container::Ptr data = IO::OpenData(fullPath, *emptyParams, Log::ProgressCallback::Stub());
+    const auto holder = std::dynamic_pointer_cast<const Module::AYM::Holder>(Module::Open(*emptyParams, data, subpath));
+    if (!holder)
+    {
+      throw Error(THIS_LINE, "Not an AY-based module");
+    }
+    return holder;
+  }
+
+  void Test(const String& msg, bool val)
+  {
+    std::cout << (val ? "Passed" : "Failed") << " test for " << msg << std::endl;
+    if (!val)
+    {
+      throw 1;
+    }
+  }
+
+  RegistersState RenderThrough(const Module::AYM::Holder& holder, uint_t frames)
+  {
+    const auto dump = std::make_shared<RegistersDump>();
+    const auto renderer = holder.CreateRenderer(holder.GetModuleProperties(), dump);
+    for (uint_t frame = 0; frame != frames && renderer->RenderFrame(); ++frame)
+    {
+    }
+    return dump->State;
+  }
+
+  RegistersState SkipThenRender(const Module::AYM::Holder& holder, uint_t skip, uint_t frames)
+  {
+    const auto dump = std::make_shared<RegistersDump>();
+    const auto renderer = holder.CreateRenderer(holder.GetModuleProperties(), dump);
+    auto& fastForward = dynamic_cast<Module::FastForward&>(*renderer);
+    Test("skip result", fastForward.SkipFrames(skip));
+    Test("position after skip", renderer->GetTrackState()->Frame() == skip);
+    for (uint_t frame = skip; frame != frames && renderer->RenderFrame(); ++frame)
+    {
+    }
+    return dump->State;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    const String path = argc < 2 ? "../../../../regression/atom_ant.ay" : argv[1];
+    const String subpath = argc < 3 ? "#1" : argv[2];
+    const auto holder = OpenModuleByPath(path, subpath);
+    const uint_t frames = holder->GetModuleInformation()->FramesCount();
+    for (uint_t skip = 1; skip < frames; skip *= 4)
+    {
+      const uint_t toRender = std::min(frames, skip + 50);
+      Test("registers state after skipping " + std::to_string(skip) + " frames",
+        RenderThrough(*holder, toRender) == SkipThenRender(*holder, skip, toRender));
+    }
+    return 0;
+  }
+  catch (const Error& e)
+  {
+    std::cout << e.ToString() << std::endl;
+    return 1;
+  }
+  catch (int code)
+  {
+    return code;
+  }
+}
@@ -0,0 +1,90 @@
+/**
+*
+* @file
+*
+* @brief  Resolved locations cache test
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+#include <analysis/path.h>
+#include <binary/container_factories.h>
+#include <core/src/location.h>
+#include <core/src/location_cache.h>
+
+#include <iostream>
+
+namespace
+{
+  template<class T>
+  void Test(const String& msg, T result, T reference)
+  {
+    if (result == reference)
+    {
+      std::cout << "Passed test for " << msg << std::endl;
+    }
+    else
+    {
+      std::cout << "Failed test for " << msg << " (got: " << result << " expected: " << reference << ")" << std::endl;
+      throw 1;
+    }
+  }
+
+  Binary::Container::Ptr CreateSource(std::size_t size)
+  {
+    std::unique_ptr<Dump> data(new Dump(size));
+    return Binary::CreateContainer(std::move(data));
+  }
+
+  ZXTune::DataLocation::Ptr CreateNested(const Binary::Container::Ptr& source, std::size_t size, const String& path)
+  {
+    return ZXTune::CreateLocation(source->GetSubcontainer(0, size), "PLUGIN", path);
+  }
+
+  String Find(ZXTune::ResolvedLocationsCache& cache, const Binary::Container::Ptr& source, const String& path)
+  {
+    const auto location = cache.Find(source, *Analysis::ParsePath(path, '/'));
+    return location ? location->GetPath()->AsString() : String("<none>");
+  }
+}
+
+int main()
+{
+  try
+  {
+    const auto cache = ZXTune::ResolvedLocationsCache::Create(2, 1000);
+    const auto first = CreateSource(1000);
+    Test<String>("empty.Find", Find(*cache, first, "a/b"), "<none>");
+    cache->Add(first, *CreateNested(first, 500, "a"));
+    cache->Add(first, *CreateNested(first, 100, "a/b"));
+    Test<std::size_t>("filled.GetSize", cache->GetSize(), 600);
+    Test<String>("sibling.Find", Find(*cache, first, "a/c"), "a");
+    Test<String>("nested.Find", Find(*cache, first, "a/b/c"), "a/b");
+    Test<String>("unknown.Find", Find(*cache, first, "b/a"), "<none>");
+    Test<String>("another source.Find", Find(*cache, CreateSource(1000), "a/c"), "<none>");
+    cache->Add(first, *CreateNested(first, 200, "a/b"));
+    Test<std::size_t>("replaced.GetSize", cache->GetSize(), 700);
+
+    const auto second = CreateSource(1000);
+    auto third = CreateSource(1000);
+    cache->Add(second, *CreateNested(second, 10, "x"));
+    cache->Add(third, *CreateNested(third, 10, "y"));
+    Test<String>("sources limit.Find(first)", Find(*cache, first, "a/c"), "<none>");
+    Test<std::size_t>("sources limit.GetSize", cache->GetSize(), 20);
+
+    cache->Add(third, *CreateNested(third, 985, "z"));
+    Test<String>("size limit.Find(second)", Find(*cache, second, "x"), "<none>");
+    Test<String>("size limit.Find(third)", Find(*cache, third, "z/a"), "z");
+    Test<std::size_t>("size limit.GetSize", cache->GetSize(), 995);
+
+    Test<long>("source is not referenced", third.use_count(), 1);
+    third.reset();
+    Test<String>("expired.Find", Find(*cache, second, "x"), "<none>");
+    Test<std::size_t>("expired.GetSize", cache->GetSize(), 0);
+  }
+  catch (int code)
+  {
+    return code;
+  }
+}
@@ -0,0 +1,168 @@
+/**
+*
+* @file
+*
+* @brief  Runtime metrics and tracing interface
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+#pragma once
+
+//common includes
+#include <types.h>
+//std includes
+#include <atomic>
+#include <chrono>
+#include <string>
+
+/*
+  Collection is switched on by environment variables containing output file names:
+    ZXTUNE_METRICS - counters, gauges and histograms in Prometheus text format
+    ZXTUNE_TRACE - timed spans in Chrome trace event format (chrome://tracing)
+  Files are written at program exit. Disabled metrics objects are null handles, so instrumentation costs single branch.
+*/
+namespace Debug
+{
+  namespace Metrics
+  {
+    //! @brief Checks if any kind of collection is enabled
+    bool IsEnabled();
+
+    //! @brief Monotonic counter handle
+    class Counter
+    {
+    public:
+      //! @param name Metric name in Prometheus notation, e.g. "zxtune_io_prefetch_hits_total"
+      //! @param labels Optional labels set, e.g. "plugin=\"PT3\""
+      explicit Counter(const std::string& name, const std::string& labels = std::string());
+
+      void Add(uint64_t delta = 1) const
+      {
+        if (Value)
+        {
+          Value->fetch_add(delta, std::memory_order_relaxed);
+        }
+      }
+    private:
+      std::atomic<uint64_t>* const Value;
+    };
+
+    //! @brief Arbitrary changing value handle
+    class Gauge
+    {
+    public:
+      explicit Gauge(const std::string& name, const std::string& labels = std::string());
+
+      void Set(int64_t value) const
+      {
+        if (Value)
+        {
+          Value->store(value, std::memory_order_relaxed);
+        }
+      }
+
+      void Add(int64_t delta) const
+      {
+        if (Value)
+        {
+          Value->fetch_add(delta, std::memory_order_relaxed);
+        }
+      }
+    private:
+      std::atomic<int64_t>* const Value;
+    };
+
+    struct HistogramData;
+
+    //! @brief Durations distribution handle with exponential buckets from 1uS to ~16S
+    class Histogram
+    {
+    public:
+      explicit Histogram(const std::string& name, const std::string& labels = std::string());
+
+      bool IsActive() const
+      {
+        return Data != nullptr;
+      }
+
+      void Observe(std::chrono::microseconds duration) const
+      {
+        if (Data)
+        {
+          Add(duration);
+        }
+      }
+    private:
+      friend class Span;
+      void Add(std::chrono::microseconds duration) const;
+      void Trace(std::chrono::steady_clock::time_point start, std::chrono::microseconds duration) const;
+    private:
+      HistogramData* const Data;
+    };
+
+    //! @brief Family of histograms with the same name differing by single label value
+    class HistogramFamily
+    {
+    public:
+      HistogramFamily(std::string name, std::string label)
+        : Name(std::move(name))
+        , Label(std::move(label))
+      {
+      }
+
+      //! @brief Lookups histogram for specified label value. Cheap if collection is disabled
+      Histogram Get(const String& value) const
+      {
+        return IsEnabled()
+          ? Histogram(Name, Label + "=\"" + value + '\"')
+          : Histogram(std::string());
+      }
+    private:
+      const std::string Name;
+      const std::string Label;
+    };
+
+    /*
+      @brief Measures scope execution time
+      @code
+        const Debug::Metrics::Histogram RenderTime("zxtune_render_duration_seconds");
+        ...
+        {
+          const Debug::Metrics::Span span(RenderTime);
+          Render();
+        }
+      @endcode
+      Also emits trace event named after histogram if tracing is enabled
+    */
+    class Span
+    {
+    public:
+      explicit Span(const Histogram& target)
+        : Target(target)
+      {
+        if (Target.IsActive())
+        {
+          Start = std::chrono::steady_clock::now();
+        }
+      }
+
+      ~Span()
+      {
+        if (Target.IsActive())
+        {
+          const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - Start);
+          Target.Add(duration);
+          Target.Trace(Start, duration);
+        }
+      }
+
+      Span(const Span&) = delete;
+      Span& operator = (const Span&) = delete;
+    private:
+      const Histogram Target;
+      std::chrono::steady_clock::time_point Start;
+    };
+  }
+}
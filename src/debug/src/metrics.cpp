@@ -0,0 +1,327 @@
+/**
+*
+* @file
+*
+* @brief  Runtime metrics and tracing implementation
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+//library includes
+#include <debug/metrics.h>
+//std includes
+#include <array>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace Debug
+{
+  namespace Metrics
+  {
+    //1uS..2^24uS, last one is +Inf
+    const std::size_t HISTOGRAM_BUCKETS = 26;
+
+    struct HistogramData
+    {
+      std::string Name;
+      std::array<std::atomic<uint64_t>, HISTOGRAM_BUCKETS> Buckets;
+      std::atomic<uint64_t> Count;
+      std::atomic<uint64_t> Sum;
+
+      explicit HistogramData(std::string name)
+        : Name(std::move(name))
+        , Count()
+        , Sum()
+      {
+        for (auto& bucket : Buckets)
+        {
+          bucket = 0;
+        }
+      }
+
+      static std::size_t GetBucket(uint64_t micros)
+      {
+        std::size_t idx = 0;
+        for (uint64_t limit = 1; idx < HISTOGRAM_BUCKETS - 1 && micros > limit; limit <<= 1)
+        {
+          ++idx;
+        }
+        return idx;
+      }
+    };
+  }
+}
+
+namespace
+{
+  using namespace Debug::Metrics;
+
+  // environment variables with output files names
+  const char METRICS_VARIABLE[] = "ZXTUNE_METRICS";
+  const char TRACE_VARIABLE[] = "ZXTUNE_TRACE";
+
+  // limit memory used by trace
+  const std::size_t MAX_TRACE_EVENTS = 1 << 20;
+
+  struct TraceEvent
+  {
+    const HistogramData* Source;
+    uint64_t Start;
+    uint64_t Duration;
+    std::size_t Thread;
+  };
+
+  std::string EscapeJson(const std::string& str)
+  {
+    std::string res;
+    for (const auto sym : str)
+    {
+      if (sym == '\"' || sym == '\\')
+      {
+        res += '\\';
+      }
+      res += sym;
+    }
+    return res;
+  }
+
+  std::string MakeName(const std::string& name, const std::string& labels)
+  {
+    return labels.empty()
+      ? name
+      : name + '{' + labels + '}';
+  }
+
+  //adds label to possibly labeled metric name
+  std::string AddLabel(const std::string& name, const std::string& suffix, const std::string& label)
+  {
+    const auto bracePos = name.find('{');
+    if (bracePos == std::string::npos)
+    {
+      return name + suffix + (label.empty() ? std::string() : '{' + label + '}');
+    }
+    else
+    {
+      const auto base = name.substr(0, bracePos) + suffix + name.substr(bracePos);
+      return label.empty()
+        ? base
+        : base.substr(0, base.size() - 1) + ',' + label + '}';
+    }
+  }
+
+  std::string GetBaseName(const std::string& name)
+  {
+    return name.substr(0, name.find('{'));
+  }
+
+  class Registry
+  {
+  public:
+    static Registry& Instance()
+    {
+      static Registry self;
+      return self;
+    }
+
+    ~Registry()
+    {
+      if (!MetricsFile.empty())
+      {
+        std::ofstream stream(MetricsFile.c_str());
+        WriteMetrics(stream);
+      }
+      if (!TraceFile.empty())
+      {
+        std::ofstream stream(TraceFile.c_str());
+        WriteTrace(stream);
+      }
+    }
+
+    bool IsEnabled() const
+    {
+      return Enabled;
+    }
+
+    bool IsTracing() const
+    {
+      return !TraceFile.empty();
+    }
+
+    std::atomic<uint64_t>* GetCounter(const std::string& name)
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      return &Counters[name];
+    }
+
+    std::atomic<int64_t>* GetGauge(const std::string& name)
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      return &Gauges[name];
+    }
+
+    HistogramData* GetHistogram(const std::string& name)
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      auto it = Histograms.find(name);
+      if (it == Histograms.end())
+      {
+        it = Histograms.insert(std::make_pair(name, std::unique_ptr<HistogramData>(new HistogramData(name)))).first;
+      }
+      return it->second.get();
+    }
+
+    void AddTraceEvent(const HistogramData& src, std::chrono::steady_clock::time_point start, std::chrono::microseconds duration)
+    {
+      const TraceEvent evt = {&src, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(start - Started).count()),
+        static_cast<uint64_t>(duration.count()), std::hash<std::thread::id>()(std::this_thread::get_id())};
+      const std::lock_guard<std::mutex> lock(Guard);
+      if (Events.size() < MAX_TRACE_EVENTS)
+      {
+        Events.push_back(evt);
+      }
+      else
+      {
+        ++DroppedEvents;
+      }
+    }
+  private:
+    Registry()
+      : MetricsFile(GetVariable(METRICS_VARIABLE))
+      , TraceFile(GetVariable(TRACE_VARIABLE))
+      , Enabled(!MetricsFile.empty() || !TraceFile.empty())
+      , Started(std::chrono::steady_clock::now())
+      , DroppedEvents()
+    {
+    }
+
+    static std::string GetVariable(const char* name)
+    {
+      const char* const val = ::getenv(name);
+      return val ? val : "";
+    }
+
+    void WriteMetrics(std::ostream& str) const
+    {
+      std::string lastType;
+      for (const auto& counter : Counters)
+      {
+        WriteType(str, counter.first, "counter", lastType);
+        str << counter.first << ' ' << counter.second.load() << '\n';
+      }
+      for (const auto& gauge : Gauges)
+      {
+        WriteType(str, gauge.first, "gauge", lastType);
+        str << gauge.first << ' ' << gauge.second.load() << '\n';
+      }
+      for (const auto& hist : Histograms)
+      {
+        const HistogramData& data = *hist.second;
+        WriteType(str, data.Name, "histogram", lastType);
+        uint64_t cumulative = 0;
+        for (std::size_t idx = 0; idx != HISTOGRAM_BUCKETS; ++idx)
+        {
+          cumulative += data.Buckets[idx].load();
+          const std::string limit = idx == HISTOGRAM_BUCKETS - 1
+            ? std::string("+Inf")
+            : std::to_string(double(uint64_t(1) << idx) / 1e6);
+          str << AddLabel(data.Name, "_bucket", "le=\"" + limit + '\"') << ' ' << cumulative << '\n';
+        }
+        str << AddLabel(data.Name, "_sum", std::string()) << ' ' << double(data.Sum.load()) / 1e6 << '\n';
+        str << AddLabel(data.Name, "_count", std::string()) << ' ' << data.Count.load() << '\n';
+      }
+    }
+
+    static void WriteType(std::ostream& str, const std::string& name, const char* type, std::string& lastType)
+    {
+      const auto baseName = GetBaseName(name);
+      if (baseName != lastType)
+      {
+        str << "# TYPE " << baseName << ' ' << type << '\n';
+        lastType = baseName;
+      }
+    }
+
+    void WriteTrace(std::ostream& str) const
+    {
+      str << "{\"traceEvents\":[";
+      for (auto it = Events.begin(), lim = Events.end(); it != lim; ++it)
+      {
+        str << (it == Events.begin() ? "\n" : ",\n")
+            << "{\"name\":\"" << EscapeJson(it->Source->Name) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << it->Thread
+            << ",\"ts\":" << it->Start << ",\"dur\":" << it->Duration << '}';
+      }
+      str << "\n],\"otherData\":{\"dropped\":" << DroppedEvents << "}}\n";
+    }
+  private:
+    const std::string MetricsFile;
+    const std::string TraceFile;
+    const bool Enabled;
+    const std::chrono::steady_clock::time_point Started;
+    std::mutex Guard;
+    //std::map provides stable addresses and sorted output
+    std::map<std::string, std::atomic<uint64_t> > Counters;
+    std::map<std::string, std::atomic<int64_t> > Gauges;
+    std::map<std::string, std::unique_ptr<HistogramData> > Histograms;
+    std::deque<TraceEvent> Events;
+    uint64_t DroppedEvents;
+  };
+
+  template<class T>
+  T* GetIfEnabled(const std::string& name, const std::string& labels, T* (Registry::*getter)(const std::string&))
+  {
+    Registry& registry = Registry::Instance();
+    return registry.IsEnabled() && !name.empty()
+      ? (registry.*getter)(MakeName(name, labels))
+      : nullptr;
+  }
+}
+
+namespace Debug
+{
+  namespace Metrics
+  {
+    bool IsEnabled()
+    {
+      static const bool enabled = Registry::Instance().IsEnabled();
+      return enabled;
+    }
+
+    Counter::Counter(const std::string& name, const std::string& labels)
+      : Value(GetIfEnabled(name, labels, &Registry::GetCounter))
+    {
+    }
+
+    Gauge::Gauge(const std::string& name, const std::string& labels)
+      : Value(GetIfEnabled(name, labels, &Registry::GetGauge))
+    {
+    }
+
+    Histogram::Histogram(const std::string& name, const std::string& labels)
+      : Data(GetIfEnabled(name, labels, &Registry::GetHistogram))
+    {
+    }
+
+    void Histogram::Add(std::chrono::microseconds duration) const
+    {
+      const uint64_t micros = duration.count();
+      Data->Buckets[HistogramData::GetBucket(micros)].fetch_add(1, std::memory_order_relaxed);
+      Data->Count.fetch_add(1, std::memory_order_relaxed);
+      Data->Sum.fetch_add(micros, std::memory_order_relaxed);
+    }
+
+    void Histogram::Trace(std::chrono::steady_clock::time_point start, std::chrono::microseconds duration) const
+    {
+      Registry& registry = Registry::Instance();
+      if (registry.IsTracing())
+      {
+        registry.AddTraceEvent(*Data, start, duration);
+      }
+    }
+  }
+}
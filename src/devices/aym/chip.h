@@ -26,6 +26,10 @@ namespace Devices
     {
     public:
       typedef std::shared_ptr<Chip> Ptr;
+
+      /// Render chunks range (possibly covering many frames) appending result directly to target
+      /// @note Sound receiver is not used, reserve target's capacity to avoid reallocations
+      virtual void RenderBlock(const DataChunk* begin, const DataChunk* end, Sound::Chunk& target) = 0;
     };
 
     enum ChannelMasks
@@ -52,7 +56,9 @@ namespace Devices
     {
       INTERPOLATION_NONE = 0,
       INTERPOLATION_LQ = 1,
-      INTERPOLATION_HQ = 2
+      INTERPOLATION_HQ = 2,
+      //! Same as HQ using 4th order low-pass filter
+      INTERPOLATION_HQ_CASCADED = 3
     };
 
     enum ChipType
@@ -30,6 +30,7 @@ namespace AYM
       , LQ(clock, psg)
       , MQ(clock, psg)
       , HQ(clock, psg)
+      , HQCascaded(clock, psg)
       , Current()
     {
     }
@@ -48,6 +49,7 @@ namespace AYM
       {
         Clock.SetFrequency(clockFreq, soundFreq);
         HQ.SetClockFrequency(clockFreq);
+        HQCascaded.SetClockFrequency(clockFreq);
         ClockFreq = clockFreq;
         SoundFreq = soundFreq;
       }
@@ -63,6 +65,9 @@ namespace AYM
       case INTERPOLATION_HQ:
         Current = &HQ;
         break;
+      case INTERPOLATION_HQ_CASCADED:
+        Current = &HQCascaded;
+        break;
       default:
         Current = &LQ;
         break;
@@ -85,6 +90,7 @@ namespace AYM
     Details::LQRenderer<Stamp, PSGType> LQ;
     Details::MQRenderer<Stamp, PSGType> MQ;
     Details::HQRenderer<Stamp, PSGType> HQ;
+    Details::HQRenderer<Stamp, PSGType, Sound::CascadedLPFilter> HQCascaded;
     Details::Renderer<Stamp>* Current;
   };
 }
@@ -59,20 +59,47 @@ namespace AYM
         const uint_t samples = Clock.SamplesTill(end);
         Sound::ChunkBuilder builder;
         builder.Reserve(samples);
-        for (const auto& chunk : src)
-        {
-          Renderers.Render(chunk.TimeStamp, builder);
-          PSG.SetNewData(chunk.Data);
-        }
+        RenderChunks(&src.front(), &src.back() + 1, builder);
         Target->ApplyData(builder.CaptureResult());
         Target->Flush();
       }
       else
       {
-        for (const auto& chunk : src)
+        ApplyChunks(&src.front(), &src.back() + 1);
+      }
+    }
+
+    void RenderBlock(const typename Traits::DataChunkType* begin, const typename Traits::DataChunkType* end, Sound::Chunk& target) override
+    {
+      if (begin == end)
+      {
+        return;
+      }
+      const Stamp till = (end - 1)->TimeStamp;
+      if (Clock.HasSamplesBefore(till))
+      {
+        SynchronizeParameters();
+        //reserve space for possible rounding errors on each chunk
+        const uint_t samples = Clock.SamplesTill(till) + (end - begin);
+        Sound::ChunkBuilder builder;
+        builder.Append(std::move(target), samples);
+        for (auto it = begin; it != end; ++it)
         {
-          PSG.SetNewData(chunk.Data);
+          if (Clock.HasSamplesBefore(it->TimeStamp))
+          {
+            Renderers.Render(it->TimeStamp, Clock.SamplesTill(it->TimeStamp), builder);
+          }
+          else
+          {
+            Renderers.Render(it->TimeStamp, builder);
+          }
+          PSG.SetNewData(it->Data);
         }
+        target = builder.CaptureResult();
+      }
+      else
+      {
+        ApplyChunks(begin, end);
       }
     }
 
@@ -83,16 +110,14 @@ namespace AYM
       Renderers.Reset();
     }
 
-    MultiChannelState GetState() const override
+    void GetState(MultiChannelState& result) const override
     {
-      MultiChannelState res;
-      res.reserve(Traits::VOICES);
-      PSG.GetState(res);
-      for (auto& re : res)
+      const std::size_t start = result.size();
+      PSG.GetState(result);
+      for (auto it = result.begin() + start, lim = result.end(); it != lim; ++it)
       {
-        re.Band = Analyser.GetBandByPeriod(re.Band);
+        it->Band = Analyser.GetBandByPeriod(it->Band);
       }
-      return res;
     }
   private:
     void SynchronizeParameters()
@@ -111,6 +136,23 @@ namespace AYM
       }
     }
 
+    void RenderChunks(const typename Traits::DataChunkType* begin, const typename Traits::DataChunkType* end, Sound::ChunkBuilder& target)
+    {
+      for (auto it = begin; it != end; ++it)
+      {
+        Renderers.Render(it->TimeStamp, target);
+        PSG.SetNewData(it->Data);
+      }
+    }
+
+    void ApplyChunks(const typename Traits::DataChunkType* begin, const typename Traits::DataChunkType* end)
+    {
+      for (auto it = begin; it != end; ++it)
+      {
+        PSG.SetNewData(it->Data);
+      }
+    }
+
     void RenderTill(Stamp stamp)
     {
       const uint_t samples = Clock.SamplesTill(stamp);
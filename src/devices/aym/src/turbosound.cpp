@@ -12,11 +12,15 @@
 #include "psg.h"
 #include "soundchip.h"
 //common includes
+#include <contract.h>
 #include <make_ptr.h>
 //library includes
 #include <devices/turbosound.h>
+#include <devices/details/parallel_helper.h>
 //std includes
+#include <algorithm>
 #include <utility>
+#include <vector>
 
 namespace Devices
 {
@@ -93,17 +97,270 @@ namespace TurboSound
     Sound::Sample ApplyData(const MixerType::InDataType& in) const override
     {
       const Sound::Sample out = DelegateRef.ApplyData(in);
-      return Sound::Sample(out.Left() / 2, out.Right() / 2);
+      return Halve(out);
+    }
+
+    void ApplyData(const MixerType::InDataType* in, std::size_t count, Sound::Sample* out) const override
+    {
+      DelegateRef.ApplyData(in, count, out);
+      std::transform(out, out + count, out, &Halve);
+    }
+  private:
+    static Sound::Sample Halve(Sound::Sample in)
+    {
+      return Sound::Sample(in.Left() / 2, in.Right() / 2);
     }
   private:
     const MixerType::Ptr Delegate;
     const MixerType& DelegateRef;
   };
 
+  //Snapshot of parameters taken on the caller's thread while no chip is rendered concurrently.
+  //Version polling may also update mixer, so chips only read it after synchronization
+  class SynchronizedParameters : public ChipParameters
+  {
+  public:
+    typedef std::shared_ptr<SynchronizedParameters> Ptr;
+
+    explicit SynchronizedParameters(ChipParameters::Ptr delegate)
+      : Delegate(std::move(delegate))
+      , CurrentVersion()
+      , ClockFreqValue()
+      , SoundFreqValue()
+      , TypeValue()
+      , InterpolationValue()
+      , DutyCycleValueValue()
+      , DutyCycleMaskValue()
+      , LayoutValue()
+    {
+      Capture(Delegate->Version());
+    }
+
+    void Synchronize()
+    {
+      const uint_t newVersion = Delegate->Version();
+      if (newVersion != CurrentVersion)
+      {
+        Capture(newVersion);
+      }
+    }
+
+    uint_t Version() const override
+    {
+      return CurrentVersion;
+    }
+
+    uint64_t ClockFreq() const override
+    {
+      return ClockFreqValue;
+    }
+
+    uint_t SoundFreq() const override
+    {
+      return SoundFreqValue;
+    }
+
+    AYM::ChipType Type() const override
+    {
+      return TypeValue;
+    }
+
+    AYM::InterpolationType Interpolation() const override
+    {
+      return InterpolationValue;
+    }
+
+    uint_t DutyCycleValue() const override
+    {
+      return DutyCycleValueValue;
+    }
+
+    uint_t DutyCycleMask() const override
+    {
+      return DutyCycleMaskValue;
+    }
+
+    AYM::LayoutType Layout() const override
+    {
+      return LayoutValue;
+    }
+  private:
+    void Capture(uint_t version)
+    {
+      CurrentVersion = version;
+      ClockFreqValue = Delegate->ClockFreq();
+      SoundFreqValue = Delegate->SoundFreq();
+      TypeValue = Delegate->Type();
+      InterpolationValue = Delegate->Interpolation();
+      DutyCycleValueValue = Delegate->DutyCycleValue();
+      DutyCycleMaskValue = Delegate->DutyCycleMask();
+      LayoutValue = Delegate->Layout();
+    }
+  private:
+    const ChipParameters::Ptr Delegate;
+    uint_t CurrentVersion;
+    uint64_t ClockFreqValue;
+    uint_t SoundFreqValue;
+    AYM::ChipType TypeValue;
+    AYM::InterpolationType InterpolationValue;
+    uint_t DutyCycleValueValue;
+    uint_t DutyCycleMaskValue;
+    AYM::LayoutType LayoutValue;
+  };
+
+  //Keeps output of single chip till merging
+  class ChunkCollector : public Sound::Receiver
+  {
+  public:
+    typedef std::shared_ptr<ChunkCollector> Ptr;
+
+    void ApplyData(Sound::Chunk data) override
+    {
+      if (Data.empty())
+      {
+        Data = std::move(data);
+      }
+      else if (const std::size_t size = data.size())
+      {
+        const std::size_t prevSize = Data.size();
+        Data.resize(prevSize + size);
+        std::copy(data.data(), data.data() + size, Data.data() + prevSize);
+      }
+    }
+
+    void Flush() override
+    {
+    }
+
+    Sound::Chunk CaptureResult()
+    {
+      return std::move(Data);
+    }
+  private:
+    Sound::Chunk Data;
+  };
+
+  //Each chip is rendered separately, second one on the shared workers pool. Results are merged afterwards
+  class ParallelChip : public Chip
+  {
+  public:
+    ParallelChip(ChipParameters::Ptr params, MixerType::Ptr mixer, Sound::Receiver::Ptr target)
+      : Params(MakePtr<SynchronizedParameters>(std::move(params)))
+      , Target(std::move(target))
+      , FirstOutput(MakePtr<ChunkCollector>())
+      , SecondOutput(MakePtr<ChunkCollector>())
+      , First(AYM::CreateChip(Params, mixer, FirstOutput))
+      , Second(AYM::CreateChip(Params, mixer, SecondOutput))
+    {
+    }
+
+    void RenderData(const DataChunk& src) override
+    {
+      Params->Synchronize();
+      Split(&src, &src + 1);
+      Tasks.Execute([this]() {Second->RenderData(SecondData.front());}, [this]() {First->RenderData(FirstData.front());});
+      FlushOutput();
+    }
+
+    void RenderData(const std::vector<DataChunk>& src) override
+    {
+      if (src.empty())
+      {
+        return;
+      }
+      Params->Synchronize();
+      Split(&src.front(), &src.back() + 1);
+      Tasks.Execute([this]() {Second->RenderData(SecondData);}, [this]() {First->RenderData(FirstData);});
+      FlushOutput();
+    }
+
+    void RenderBlock(const DataChunk* begin, const DataChunk* end, Sound::Chunk& target) override
+    {
+      if (begin == end)
+      {
+        return;
+      }
+      Params->Synchronize();
+      Split(begin, end);
+      Sound::Chunk first;
+      Sound::Chunk second;
+      Tasks.Execute([this, &second]() {Second->RenderBlock(SecondData.data(), SecondData.data() + SecondData.size(), second);},
+                    [this, &first]() {First->RenderBlock(FirstData.data(), FirstData.data() + FirstData.size(), first);});
+      Merge(first, second, target);
+    }
+
+    void Reset() override
+    {
+      First->Reset();
+      Second->Reset();
+    }
+
+    void GetState(MultiChannelState& result) const override
+    {
+      First->GetState(result);
+      Second->GetState(result);
+    }
+  private:
+    void Split(const DataChunk* begin, const DataChunk* end)
+    {
+      const std::size_t count = end - begin;
+      FirstData.resize(count);
+      SecondData.resize(count);
+      for (std::size_t idx = 0; idx != count; ++idx)
+      {
+        const DataChunk& src = begin[idx];
+        FirstData[idx].TimeStamp = SecondData[idx].TimeStamp = src.TimeStamp;
+        FirstData[idx].Data = src.Data[0];
+        SecondData[idx].Data = src.Data[1];
+      }
+    }
+
+    static void Merge(const Sound::Chunk& first, const Sound::Chunk& second, Sound::Chunk& target)
+    {
+      //chips are clocked identically
+      Require(first.size() == second.size());
+      const std::size_t size = first.size();
+      if (!size)
+      {
+        return;
+      }
+      const std::size_t prevSize = target.size();
+      target.resize(prevSize + size);
+      std::transform(first.data(), first.data() + size, second.data(), target.data() + prevSize, &Sound::Sample::FastAdd);
+    }
+
+    void FlushOutput()
+    {
+      Sound::Chunk result;
+      Merge(FirstOutput->CaptureResult(), SecondOutput->CaptureResult(), result);
+      if (!result.empty())
+      {
+        Target->ApplyData(std::move(result));
+        Target->Flush();
+      }
+    }
+  private:
+    const SynchronizedParameters::Ptr Params;
+    const Sound::Receiver::Ptr Target;
+    const ChunkCollector::Ptr FirstOutput;
+    const ChunkCollector::Ptr SecondOutput;
+    const AYM::Chip::Ptr First;
+    const AYM::Chip::Ptr Second;
+    std::vector<AYM::DataChunk> FirstData;
+    std::vector<AYM::DataChunk> SecondData;
+    Details::ParallelTasks Tasks;
+  };
+
   Chip::Ptr CreateChip(ChipParameters::Ptr params, MixerType::Ptr mixer, Sound::Receiver::Ptr target)
   {
     const MixerType::Ptr halfMixer = MakePtr<HalfLevelMixer>(mixer);
     return MakePtr<AYM::SoundChip<Traits> >(params, halfMixer, target);
   }
+
+  Chip::Ptr CreateParallelChip(ChipParameters::Ptr params, MixerType::Ptr mixer, Sound::Receiver::Ptr target)
+  {
+    const MixerType::Ptr halfMixer = MakePtr<HalfLevelMixer>(mixer);
+    return MakePtr<ParallelChip>(params, halfMixer, target);
+  }
 }
 }
@@ -19,9 +19,9 @@
 #include <parameters/tracking_helper.h>
 #include <sound/chunk_builder.h>
 //std includes
+#include <algorithm>
 #include <array>
 #include <cmath>
-#include <functional>
 
 namespace Devices
 {
@@ -92,18 +92,18 @@ namespace DAC
         return Pos.Integer();
       }
 
-      Sound::Sample::Type GetNearest() const
+      //value at specified offset (in steps) from current position, should not cross sample end
+      Sound::Sample::Type GetNearest(uint_t offset) const
       {
-        assert(IsValid());
-        return Data[Pos.Integer()];
+        return Data[GetRawPosition(offset) / Position::PRECISION];
       }
 
-      Sound::Sample::Type GetInterpolated(const uint_t* lookup) const
+      Sound::Sample::Type GetInterpolated(uint_t offset, const uint_t* lookup) const
       {
-        assert(IsValid());
-        if (const int_t fract = Pos.Fraction())
+        const uint_t raw = GetRawPosition(offset);
+        const Sound::Sample::Type* const cur = Data + raw / Position::PRECISION;
+        if (const int_t fract = raw % Position::PRECISION)
         {
-          const Sound::Sample::Type* const cur = Data + Pos.Integer();
           const int_t curVal = *cur;
           const int_t nextVal = *(cur + 1);
           const int_t delta = nextVal - curVal;
@@ -111,7 +111,26 @@ namespace DAC
         }
         else
         {
-          return Data[Pos.Integer()];
+          return *cur;
+        }
+      }
+
+      //steps count (but not more than limit) till sample end or loop
+      uint_t GetStepsTillEnd(uint_t limit) const
+      {
+        assert(IsValid() || Pos == Limit);
+        if (!(Pos < Limit))
+        {
+          return 1;
+        }
+        else if (const uint_t step = Step.Raw())
+        {
+          const uint64_t steps = (uint64_t((Limit - Pos).Raw()) + step - 1) / step;
+          return static_cast<uint_t>(std::min<uint64_t>(steps, limit));
+        }
+        else
+        {
+          return limit;
         }
       }
 
@@ -120,9 +139,11 @@ namespace DAC
         Pos = 0;
       }
 
-      void Next()
+      //steps count should not be more than GetStepsTillEnd
+      void Skip(uint_t steps)
       {
-        Pos = GetNextPos();
+        const Position res(GetRawPosition(steps), Position::PRECISION);
+        Pos = res < Limit ? res : Loop;
       }
 
       void SetPosition(uint_t pos)
@@ -147,10 +168,9 @@ namespace DAC
         Pos = std::min(Pos, Limit);
       }
     private:
-      Position GetNextPos() const
+      uint_t GetRawPosition(uint_t offset) const
       {
-        const Position res = Pos + Step;
-        return res < Limit ? res : Loop;
+        return Pos.Raw() + offset * Step.Raw();
       }
     private:
       const Sound::Sample::Type* Data;
@@ -333,26 +353,46 @@ namespace DAC
       }
     }
 
-    Sound::Sample::Type GetNearest() const
+    //output is written to specified channel of block starting from first sample
+    template<class BlockType>
+    void RenderNearest(uint_t samples, BlockType& block, uint_t chan)
     {
-      return Enabled
-        ? Amplify(Iterator.GetNearest())
-        : Sound::Sample::MID;
+      uint_t pos = 0;
+      while (pos != samples && Enabled)
+      {
+        const uint_t steps = Iterator.GetStepsTillEnd(samples - pos);
+        for (uint_t idx = 0; idx != steps; ++idx, ++pos)
+        {
+          block[pos][chan] = Amplify(Iterator.GetNearest(idx));
+        }
+        Skip(steps);
+      }
+      Silence(pos, samples, block, chan);
     }
 
-    Sound::Sample::Type GetInterpolated(const uint_t* lookup) const
+    template<class BlockType>
+    void RenderInterpolated(uint_t samples, const uint_t* lookup, BlockType& block, uint_t chan)
     {
-      return Enabled
-        ? Amplify(Iterator.GetInterpolated(lookup))
-        : Sound::Sample::MID;
+      uint_t pos = 0;
+      while (pos != samples && Enabled)
+      {
+        const uint_t steps = Iterator.GetStepsTillEnd(samples - pos);
+        for (uint_t idx = 0; idx != steps; ++idx, ++pos)
+        {
+          block[pos][chan] = Amplify(Iterator.GetInterpolated(idx, lookup));
+        }
+        Skip(steps);
+      }
+      Silence(pos, samples, block, chan);
     }
 
-    void Next()
+    void Drop(uint_t samples)
     {
-      if (Enabled)
+      while (samples && Enabled)
       {
-        Iterator.Next();
-        Enabled = Iterator.IsValid();
+        const uint_t steps = Iterator.GetStepsTillEnd(samples);
+        Skip(steps);
+        samples -= steps;
       }
     }
 
@@ -368,8 +408,26 @@ namespace DAC
     {
       return (Level * val).Round();
     }
+
+    void Skip(uint_t steps)
+    {
+      Iterator.Skip(steps);
+      Enabled = Iterator.IsValid();
+    }
+
+    template<class BlockType>
+    static void Silence(uint_t pos, uint_t samples, BlockType& block, uint_t chan)
+    {
+      for (; pos != samples; ++pos)
+      {
+        block[pos][chan] = Sound::Sample::MID;
+      }
+    }
   };
 
+  //samples are rendered by channels in blocks and mixed afterwards
+  const uint_t BLOCK_SIZE = 256;
+
   class Renderer
   {
   public:
@@ -390,21 +448,21 @@ namespace DAC
 
     void RenderData(uint_t samples, Sound::ChunkBuilder& target) override
     {
-      typename Sound::MultichannelSample<Channels>::Type result;
-      for (uint_t counter = samples; counter != 0; --counter)
+      for (uint_t done = 0; done != samples; )
       {
+        const uint_t toRender = std::min(samples - done, BLOCK_SIZE);
         for (uint_t chan = 0; chan != Channels; ++chan)
         {
-          ChannelState& state = State[chan];
-          result[chan] = state.GetNearest();
-          state.Next();
+          State[chan].RenderNearest(toRender, Block, chan);
         }
-        target.Add(Mixer.ApplyData(result));
+        Mixer.ApplyData(&Block[0], toRender, target.Allocate(toRender));
+        done += toRender;
       }
     }
   private:
     const Sound::FixedChannelsMixer<Channels>& Mixer;
     ChannelState* const State;
+    std::array<typename Sound::MultichannelSample<Channels>::Type, BLOCK_SIZE> Block;
   };
 
   template<unsigned Channels>
@@ -420,16 +478,15 @@ namespace DAC
     void RenderData(uint_t samples, Sound::ChunkBuilder& target) override
     {
       static const CosineTable COSTABLE;
-      typename Sound::MultichannelSample<Channels>::Type result;
-      for (uint_t counter = samples; counter != 0; --counter)
+      for (uint_t done = 0; done != samples; )
       {
+        const uint_t toRender = std::min(samples - done, BLOCK_SIZE);
         for (uint_t chan = 0; chan != Channels; ++chan)
         {
-          ChannelState& state = State[chan];
-          result[chan] = state.GetInterpolated(COSTABLE.Get());
-          state.Next();
+          State[chan].RenderInterpolated(toRender, COSTABLE.Get(), Block, chan);
         }
-        target.Add(Mixer.ApplyData(result));
+        Mixer.ApplyData(&Block[0], toRender, target.Allocate(toRender));
+        done += toRender;
       }
     }
   private:
@@ -455,6 +512,7 @@ namespace DAC
   private:
     const Sound::FixedChannelsMixer<Channels>& Mixer;
     ChannelState* const State;
+    std::array<typename Sound::MultichannelSample<Channels>::Type, BLOCK_SIZE> Block;
   };
 
   template<unsigned Channels>
@@ -493,9 +551,9 @@ namespace DAC
 
     void DropData(uint_t samples)
     {
-      for (uint_t count = samples; count != 0; --count)
+      for (uint_t chan = 0; chan != Channels; ++chan)
       {
-        std::for_each(State, State + Channels, std::mem_fun_ref(&ChannelState::Next));
+        State[chan].Drop(samples);
       }
     }
   private:
@@ -545,18 +603,15 @@ namespace DAC
       UpdateChannelState(src);
     }
 
-    MultiChannelState GetState() const override
+    void GetState(MultiChannelState& result) const override
     {
-      MultiChannelState res;
-      res.reserve(State.size());
       for (const auto& chan : State)
       {
         if (chan.Enabled)
         {
-          res.push_back(chan.Analyze(Samples.GetMaxRms()));
+          result.push_back(chan.Analyze(Samples.GetMaxRms()));
         }
       }
-      return res;
     }
 
     /// reset internal state to initial
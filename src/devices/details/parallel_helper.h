@@ -0,0 +1,191 @@
+/**
+*
+* @file
+*
+* @brief  Helper for concurrent rendering of independent chips
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+#pragma once
+
+//std includes
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Devices
+{
+  namespace Details
+  {
+    //! @brief Process-wide set of background threads shared by all the devices rendered concurrently
+    class WorkersPool
+    {
+    public:
+      typedef std::function<void()> Task;
+
+      static WorkersPool& Instance()
+      {
+        static WorkersPool instance;
+        return instance;
+      }
+
+      ~WorkersPool()
+      {
+        {
+          const std::lock_guard<std::mutex> lock(Mutex);
+          Stopping = true;
+        }
+        Changed.notify_all();
+        for (auto& thread : Threads)
+        {
+          thread.join();
+        }
+      }
+
+      WorkersPool(const WorkersPool&) = delete;
+      WorkersPool& operator = (const WorkersPool&) = delete;
+
+      void Execute(Task task)
+      {
+        {
+          const std::lock_guard<std::mutex> lock(Mutex);
+          Tasks.push_back(std::move(task));
+        }
+        Changed.notify_one();
+      }
+    private:
+      WorkersPool()
+        : Stopping(false)
+      {
+        //caller's thread is busy too
+        const std::size_t count = std::max<std::size_t>(std::thread::hardware_concurrency(), 2) - 1;
+        for (std::size_t idx = 0; idx != count; ++idx)
+        {
+          Threads.emplace_back(&WorkersPool::WorkProc, this);
+        }
+      }
+
+      void WorkProc()
+      {
+        std::unique_lock<std::mutex> lock(Mutex);
+        for (;;)
+        {
+          Changed.wait(lock, [this]() {return Stopping || !Tasks.empty();});
+          if (Stopping)
+          {
+            break;
+          }
+          const Task task = std::move(Tasks.front());
+          Tasks.pop_front();
+          lock.unlock();
+          task();
+          lock.lock();
+        }
+      }
+    private:
+      std::mutex Mutex;
+      std::condition_variable Changed;
+      std::deque<Task> Tasks;
+      bool Stopping;
+      std::vector<std::thread> Threads;
+    };
+
+    //! @brief Tracks tasks scheduled by single device on the shared pool
+    //! @note Execute/Wait pairs should be called from the same thread
+    class ParallelTasks
+    {
+    public:
+      ParallelTasks()
+        : Pending()
+      {
+      }
+
+      ~ParallelTasks()
+      {
+        std::unique_lock<std::mutex> lock(Mutex);
+        Done.wait(lock, [this]() {return 0 == Pending;});
+      }
+
+      ParallelTasks(const ParallelTasks&) = delete;
+      ParallelTasks& operator = (const ParallelTasks&) = delete;
+
+      void Execute(std::function<void()> task)
+      {
+        {
+          const std::lock_guard<std::mutex> lock(Mutex);
+          ++Pending;
+        }
+        WorkersPool::Instance().Execute([this, task]() {Run(task);});
+      }
+
+      //! @brief Execute @p background task on the pool concurrently with @p foreground one in the caller's thread
+      //! @note Background task is always finished on return, even if foreground one throws
+      void Execute(std::function<void()> background, const std::function<void()>& foreground)
+      {
+        Execute(std::move(background));
+        try
+        {
+          foreground();
+        }
+        catch (...)
+        {
+          WaitAll();
+          throw;
+        }
+        Wait();
+      }
+
+      //! @brief Wait for all the scheduled tasks, rethrow first error if any
+      void Wait()
+      {
+        if (const std::exception_ptr err = WaitAll())
+        {
+          std::rethrow_exception(err);
+        }
+      }
+    private:
+      std::exception_ptr WaitAll()
+      {
+        std::unique_lock<std::mutex> lock(Mutex);
+        Done.wait(lock, [this]() {return 0 == Pending;});
+        const std::exception_ptr err = std::move(LastError);
+        LastError = nullptr;
+        return err;
+      }
+
+      void Run(const std::function<void()>& task)
+      {
+        std::exception_ptr err;
+        try
+        {
+          task();
+        }
+        catch (...)
+        {
+          err = std::current_exception();
+        }
+        const std::lock_guard<std::mutex> lock(Mutex);
+        if (err && !LastError)
+        {
+          LastError = err;
+        }
+        if (0 == --Pending)
+        {
+          Done.notify_all();
+        }
+      }
+    private:
+      std::mutex Mutex;
+      std::condition_variable Done;
+      std::size_t Pending;
+      std::exception_ptr LastError;
+    };
+  }
+}
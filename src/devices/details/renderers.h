@@ -14,6 +14,9 @@
 #include <devices/details/clock_source.h>
 #include <sound/chunk_builder.h>
 #include <sound/lpfilter.h>
+//std includes
+#include <algorithm>
+#include <array>
 
 namespace Devices
 {
@@ -189,12 +192,12 @@ namespace Details
 
   
   /*
-    Decimation is performed after 2-order IIR LPF
+    Decimation is performed after 2-order IIR LPF (or 4-order for CascadedLPFilter)
     Cutoff freq of LPF should be less than Nyquist frequency of target signal
   */
   const uint_t SOUND_CUTOFF_FREQUENCY = 9500;
   
-  template<class PSGType>
+  template<class PSGType, class FilterType = Sound::LPFilter>
   class HQWrapper
   {
   public:
@@ -210,10 +213,16 @@ namespace Details
 
     void Tick(uint_t ticksPassed)
     {
-      while (ticksPassed--)
+      while (ticksPassed)
       {
-        Filter.Feed(Delegate.GetLevels());
-        Delegate.Tick(1);
+        const uint_t ticks = std::min<uint_t>(ticksPassed, Levels.size());
+        for (uint_t idx = 0; idx != ticks; ++idx)
+        {
+          Levels[idx] = Delegate.GetLevels();
+          Delegate.Tick(1);
+        }
+        Filter.Feed(Levels.data(), ticks);
+        ticksPassed -= ticks;
       }
     }
 
@@ -222,8 +231,12 @@ namespace Details
       return Filter.Get();
     }
   private:
+    //levels are collected first to filter them by block
+    static const std::size_t LEVELS_BLOCK = 64;
+
     PSGType& Delegate;
-    Sound::LPFilter Filter;
+    FilterType Filter;
+    std::array<Sound::Sample, LEVELS_BLOCK> Levels;
   };   
 
   template<class StampType, class PSGType>
@@ -249,10 +262,10 @@ namespace Details
   private:
   };
 
-  template<class StampType, class PSGType>
-  class HQRenderer : public BaseRenderer<StampType, HQWrapper<PSGType> >
+  template<class StampType, class PSGType, class FilterType = Sound::LPFilter>
+  class HQRenderer : public BaseRenderer<StampType, HQWrapper<PSGType, FilterType> >
   {
-    typedef BaseRenderer<StampType, HQWrapper<PSGType> > Parent;
+    typedef BaseRenderer<StampType, HQWrapper<PSGType, FilterType> > Parent;
   public:
     HQRenderer(ClockSource<StampType>& clock, PSGType& psg)
       : Parent(clock, psg)
@@ -149,9 +149,9 @@ namespace FM
         SynchronizeParameters();
       }
 
-      MultiChannelState GetState() const override
+      void GetState(MultiChannelState& result) const override
       {
-        return Adapter.GetState();
+        Adapter.GetState(result);
       }
     private:
       void SynchronizeParameters()
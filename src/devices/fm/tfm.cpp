@@ -14,8 +14,10 @@
 #include <make_ptr.h>
 //library includes
 #include <devices/tfm.h>
+#include <devices/details/parallel_helper.h>
 //std includes
 #include <functional>
+#include <vector>
 
 namespace Devices
 {
@@ -60,23 +62,45 @@ namespace TFM
       Helper.ConvertSamples(outRaw, outRaw + count, out);
     }
 
-    MultiChannelState GetState() const
+    void GetState(MultiChannelState& res) const
     {
-      MultiChannelState res;
-      res.reserve(VOICES);
       std::array<uint_t, FM::VOICES> attenuations;
       std::array<uint_t, FM::VOICES> periods;
       ::YM2203GetState(Chips[0].get(), &attenuations[0], &periods[0]);
       Helper.ConvertState(attenuations.data(), periods.data(), res);
       ::YM2203GetState(Chips[1].get(), &attenuations[0], &periods[0]);
       Helper.ConvertState(attenuations.data(), periods.data(), res);
-      return res;
     }
-  private:
+  protected:
     FM::Details::ChipAdapterHelper Helper;
     std::array<FM::Details::ChipPtr, TFM::CHIPS> Chips;
   };
 
+  //second chip is rendered on the shared workers pool into separate buffer
+  class ParallelChipAdapter : public ChipAdapter
+  {
+  public:
+    void RenderSamples(uint_t count, Sound::ChunkBuilder& tgt)
+    {
+      Buffer.assign(count, 0);
+      FM::Details::YM2203SampleType* const secondRaw = Buffer.data();
+      void* const second = Chips[1].get();
+      Sound::Sample* const out = tgt.Allocate(count);
+      FM::Details::YM2203SampleType* const outRaw = safe_ptr_cast<FM::Details::YM2203SampleType*>(out);
+      void* const first = Chips[0].get();
+      Tasks.Execute([second, secondRaw, count]() {::YM2203UpdateOne(second, secondRaw, count);},
+                    [first, outRaw, count]() {::YM2203UpdateOne(first, outRaw, count);});
+      for (uint_t idx = 0; idx != count; ++idx)
+      {
+        outRaw[idx] = (outRaw[idx] + secondRaw[idx]) / 2;
+      }
+      Helper.ConvertSamples(outRaw, outRaw + count, out);
+    }
+  private:
+    std::vector<FM::Details::YM2203SampleType> Buffer;
+    Devices::Details::ParallelTasks Tasks;
+  };
+
   struct Traits
   {
     typedef Chip BaseClass;
@@ -85,11 +109,22 @@ namespace TFM
     typedef ChipAdapter AdapterType;
   };
 
+  struct ParallelTraits : Traits
+  {
+    typedef ParallelChipAdapter AdapterType;
+  };
+
   typedef FM::Details::BaseChip<Traits> TFMChip;
+  typedef FM::Details::BaseChip<ParallelTraits> ParallelTFMChip;
 
   Chip::Ptr CreateChip(ChipParameters::Ptr params, Sound::Receiver::Ptr target)
   {
     return MakePtr<TFMChip>(params, target);
   }
+
+  Chip::Ptr CreateParallelChip(ChipParameters::Ptr params, Sound::Receiver::Ptr target)
+  {
+    return MakePtr<ParallelTFMChip>(params, target);
+  }
 }
 }
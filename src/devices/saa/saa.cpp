@@ -19,6 +19,8 @@
 #include <sound/chunk_builder.h>
 #include <sound/lpfilter.h>
 //std includes
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <functional>
@@ -142,9 +144,14 @@ namespace SAA
     {
       while (ticksPassed >= FREQ_DIVIDER)
       {
-        Filter.Feed(Delegate.GetLevels());
-        Delegate.Tick(FREQ_DIVIDER);
-        ticksPassed -= FREQ_DIVIDER;
+        const uint_t levels = std::min<uint_t>(ticksPassed / FREQ_DIVIDER, Levels.size());
+        for (uint_t idx = 0; idx != levels; ++idx)
+        {
+          Levels[idx] = Delegate.GetLevels();
+          Delegate.Tick(FREQ_DIVIDER);
+        }
+        Filter.Feed(Levels.data(), levels);
+        ticksPassed -= levels * FREQ_DIVIDER;
       }
       if (ticksPassed)
       {
@@ -157,8 +164,11 @@ namespace SAA
       return Filter.Get();
     }
   private:
+    static const std::size_t LEVELS_BLOCK = 64;
+
     SAARenderer& Delegate;
     Sound::LPFilter Filter;
+    std::array<Sound::Sample, LEVELS_BLOCK> Levels;
   };   
 
   class HQRenderer : public Details::BaseRenderer<Stamp, HQWrapper>
@@ -268,15 +278,14 @@ namespace SAA
       Renderers.Reset();
     }
 
-    MultiChannelState GetState() const override
+    void GetState(MultiChannelState& result) const override
     {
-      MultiChannelState res;
-      PSG.GetState(res);
-      for (auto& state : res)
+      const std::size_t start = result.size();
+      PSG.GetState(result);
+      for (auto it = result.begin() + start, lim = result.end(); it != lim; ++it)
       {
-        state.Band = Analyser.GetBandByPeriod(state.Band);
+        it->Band = Analyser.GetBandByPeriod(it->Band);
       }
-      return res;
     }
   private:
     void SynchronizeParameters()
@@ -49,6 +49,8 @@ namespace Devices
     typedef std::shared_ptr<const StateSource> Ptr;
     virtual ~StateSource() = default;
 
-    virtual MultiChannelState GetState() const = 0;
+    //! @brief Appends current channels state to @p result
+    //! @note Caller keeps storage between calls to reuse allocated capacity
+    virtual void GetState(MultiChannelState& result) const = 0;
   };
 }
@@ -0,0 +1,183 @@
+/**
+* 
+* @file
+*
+* @brief  DAC test
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+#include <make_ptr.h>
+#include <binary/container_factories.h>
+#include <devices/dac.h>
+#include <devices/dac/sample_factories.h>
+#include <sound/chunk.h>
+#include <sound/receiver.h>
+#include <iostream>
+
+namespace
+{
+  const uint_t SOUND_FREQ = 10000;
+  const uint_t SAMPLE_PERIOD_US = 1000000 / SOUND_FREQ;
+  const uint_t SAMPLES = 1000;
+
+  typedef Sound::ThreeChannelsMixer::InDataType MultiSample;
+
+  //keeps all the input channels instead of mixing them
+  class CapturingMixer : public Sound::ThreeChannelsMixer
+  {
+  public:
+    Sound::Sample ApplyData(const InDataType& in) const override
+    {
+      Result.push_back(in);
+      return Sound::Sample();
+    }
+
+    void ApplyData(const InDataType* in, std::size_t count, Sound::Sample* out) const override
+    {
+      Result.insert(Result.end(), in, in + count);
+      std::fill(out, out + count, Sound::Sample());
+    }
+
+    mutable std::vector<MultiSample> Result;
+  };
+
+  class ChipParameters : public Devices::DAC::ChipParameters
+  {
+  public:
+    explicit ChipParameters(bool interpolate)
+      : InterpolateValue(interpolate)
+    {
+    }
+
+    uint_t Version() const override
+    {
+      return 1;
+    }
+
+    uint_t BaseSampleFreq() const override
+    {
+      return 8000;
+    }
+
+    uint_t SoundFreq() const override
+    {
+      return SOUND_FREQ;
+    }
+
+    bool Interpolate() const override
+    {
+      return InterpolateValue;
+    }
+  private:
+    const bool InterpolateValue;
+  };
+
+  class StubReceiver : public Sound::Receiver
+  {
+  public:
+    void ApplyData(Sound::Chunk /*data*/) override
+    {
+    }
+
+    void Flush() override
+    {
+    }
+  };
+
+  Devices::DAC::Sample::Ptr CreateSample(std::size_t size, std::size_t loop)
+  {
+    std::vector<uint8_t> content(size);
+    for (std::size_t idx = 0; idx != size; ++idx)
+    {
+      content[idx] = static_cast<uint8_t>(idx * 37 + (idx >> 3));
+    }
+    const auto data = Binary::CreateContainer(&content.front(), size);
+    return Devices::DAC::CreateU8Sample(*data, loop);
+  }
+
+  Devices::DAC::ChannelData MakeChannel(uint_t chan, uint_t sample, uint_t note)
+  {
+    Devices::DAC::ChannelData res;
+    res.Channel = chan;
+    res.Mask = Devices::DAC::ChannelData::ALL_PARAMETERS;
+    res.Enabled = true;
+    res.Note = note;
+    res.SampleNum = sample;
+    res.Level = Devices::LevelType(80, 100);
+    return res;
+  }
+
+  class Emulator
+  {
+  public:
+    explicit Emulator(bool interpolate)
+      : Mixer(std::make_shared<CapturingMixer>())
+      , Chip(Devices::DAC::CreateChip(MakePtr<ChipParameters>(interpolate), Mixer, MakePtr<StubReceiver>()))
+    {
+      //looped
+      Chip->SetSample(0, CreateSample(300, 100));
+      //not looped
+      Chip->SetSample(1, CreateSample(400, 400));
+      Devices::DAC::DataChunk chunk;
+      chunk.Data.push_back(MakeChannel(0, 0, 0));
+      //stops in the middle of block
+      chunk.Data.push_back(MakeChannel(1, 1, 12));
+      //step is more than sample size
+      chunk.Data.push_back(MakeChannel(2, 0, 70));
+      Chip->RenderData(chunk);
+    }
+
+    void RenderTill(uint_t sample)
+    {
+      Devices::DAC::DataChunk chunk;
+      chunk.TimeStamp = Devices::DAC::Stamp(sample * SAMPLE_PERIOD_US);
+      Chip->RenderData(chunk);
+    }
+
+    const std::vector<MultiSample>& GetResult() const
+    {
+      return Mixer->Result;
+    }
+  private:
+    const std::shared_ptr<CapturingMixer> Mixer;
+    const Devices::DAC::Chip::Ptr Chip;
+  };
+
+  void Test(const std::string& msg, bool val)
+  {
+    std::cout << (val ? "Passed" : "Failed") << " test for " << msg << std::endl;
+    if (!val)
+    {
+      throw 1;
+    }
+  }
+
+  void TestBlockRendering(bool interpolate, const std::string& mode)
+  {
+    Emulator block(interpolate);
+    block.RenderTill(SAMPLES);
+    Emulator single(interpolate);
+    for (uint_t sample = 1; sample <= SAMPLES; ++sample)
+    {
+      single.RenderTill(sample);
+    }
+    Test(mode + " block size", block.GetResult().size() == SAMPLES);
+    Test(mode + " block vs per-sample rendering", block.GetResult() == single.GetResult());
+  }
+}
+
+int main()
+{
+  try
+  {
+    TestBlockRendering(false, "nearest");
+    TestBlockRendering(true, "interpolated");
+    return 0;
+  }
+  catch (int code)
+  {
+    return code;
+  }
+}
@@ -0,0 +1,277 @@
+/**
+* 
+* @file
+*
+* @brief  Concurrent chips rendering test
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+#include <make_ptr.h>
+#include <devices/details/parallel_helper.h>
+#include <devices/tfm.h>
+#include <devices/turbosound.h>
+#include <sound/chunk.h>
+#include <sound/receiver.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+  const uint_t SOUND_FREQ = 44100;
+  const uint_t FRAME_DURATION_US = 20000;
+  const uint_t FRAMES = 500;
+
+  class Random
+  {
+  public:
+    Random()
+      : State(12345)
+    {
+    }
+
+    uint_t Next(uint_t limit)
+    {
+      State = State * 1103515245 + 12345;
+      return (State >> 16) % limit;
+    }
+  private:
+    uint32_t State;
+  };
+
+  class CollectingReceiver : public Sound::Receiver
+  {
+  public:
+    void ApplyData(Sound::Chunk data) override
+    {
+      Result.insert(Result.end(), data.begin(), data.end());
+    }
+
+    void Flush() override
+    {
+    }
+
+    std::vector<Sound::Sample> Result;
+  };
+
+  class SimpleMixer : public Sound::ThreeChannelsMixer
+  {
+  public:
+    Sound::Sample ApplyData(const InDataType& in) const override
+    {
+      return Sound::Sample((int_t(in[0]) + in[1]) / 2, (int_t(in[1]) + in[2]) / 2);
+    }
+
+    void ApplyData(const InDataType* in, std::size_t count, Sound::Sample* out) const override
+    {
+      std::transform(in, in + count, out, [this](const InDataType& smp) {return ApplyData(smp);});
+    }
+  };
+
+  class AYMParameters : public Devices::AYM::ChipParameters
+  {
+  public:
+    AYMParameters()
+      : VersionValue(1)
+      , ClockFreqValue(1773400)
+    {
+    }
+
+    void SetClockFreq(uint64_t freq)
+    {
+      ClockFreqValue = freq;
+      ++VersionValue;
+    }
+
+    uint_t Version() const override
+    {
+      return VersionValue;
+    }
+
+    uint64_t ClockFreq() const override
+    {
+      return ClockFreqValue;
+    }
+
+    uint_t SoundFreq() const override
+    {
+      return SOUND_FREQ;
+    }
+
+    Devices::AYM::ChipType Type() const override
+    {
+      return Devices::AYM::TYPE_YM2149F;
+    }
+
+    Devices::AYM::InterpolationType Interpolation() const override
+    {
+      return Devices::AYM::INTERPOLATION_NONE;
+    }
+
+    uint_t DutyCycleValue() const override
+    {
+      return 50;
+    }
+
+    uint_t DutyCycleMask() const override
+    {
+      return 0;
+    }
+
+    Devices::AYM::LayoutType Layout() const override
+    {
+      return Devices::AYM::LAYOUT_ABC;
+    }
+  private:
+    uint_t VersionValue;
+    uint64_t ClockFreqValue;
+  };
+
+  class FMParameters : public Devices::FM::ChipParameters
+  {
+  public:
+    uint_t Version() const override
+    {
+      return 1;
+    }
+
+    uint64_t ClockFreq() const override
+    {
+      return 3500000;
+    }
+
+    uint_t SoundFreq() const override
+    {
+      return SOUND_FREQ;
+    }
+  };
+
+  void Test(const std::string& msg, bool val)
+  {
+    std::cout << (val ? "Passed" : "Failed") << " test for " << msg << std::endl;
+    if (!val)
+    {
+      throw 1;
+    }
+  }
+
+  std::vector<Sound::Sample> RenderTurboSound(bool parallel, bool block)
+  {
+    const auto params = std::make_shared<AYMParameters>();
+    const auto mixer = MakePtr<SimpleMixer>();
+    const auto target = std::make_shared<CollectingReceiver>();
+    const auto chip = parallel
+      ? Devices::TurboSound::CreateParallelChip(params, mixer, target)
+      : Devices::TurboSound::CreateChip(params, mixer, target);
+    Random rnd;
+    std::vector<Devices::TurboSound::DataChunk> chunks(4);
+    for (uint_t frame = 0; frame != FRAMES; ++frame)
+    {
+      if (frame == FRAMES / 2)
+      {
+        params->SetClockFreq(1750000);
+      }
+      for (uint_t part = 0; part != chunks.size(); ++part)
+      {
+        auto& chunk = chunks[part];
+        chunk.TimeStamp = Devices::TurboSound::Stamp(uint64_t(frame * chunks.size() + part + 1) * FRAME_DURATION_US / chunks.size());
+        for (auto& regs : chunk.Data)
+        {
+          regs = Devices::AYM::Registers();
+          for (uint_t writes = rnd.Next(4); writes != 0; --writes)
+          {
+            regs[static_cast<Devices::AYM::Registers::Index>(rnd.Next(Devices::AYM::Registers::TOTAL))] = rnd.Next(256);
+          }
+        }
+      }
+      if (block)
+      {
+        Sound::Chunk output;
+        chip->RenderBlock(&chunks.front(), &chunks.back() + 1, output);
+        target->ApplyData(std::move(output));
+      }
+      else
+      {
+        chip->RenderData(chunks);
+      }
+    }
+    return target->Result;
+  }
+
+  std::vector<Sound::Sample> RenderTurboFM(bool parallel)
+  {
+    const auto params = MakePtr<FMParameters>();
+    const auto target = std::make_shared<CollectingReceiver>();
+    const auto chip = parallel
+      ? Devices::TFM::CreateParallelChip(params, target)
+      : Devices::TFM::CreateChip(params, target);
+    Random rnd;
+    Devices::TFM::DataChunk chunk;
+    for (uint_t frame = 0; frame != FRAMES; ++frame)
+    {
+      chunk.TimeStamp = Devices::TFM::Stamp(uint64_t(frame + 1) * FRAME_DURATION_US);
+      chunk.Data.clear();
+      for (uint_t writes = rnd.Next(16); writes != 0; --writes)
+      {
+        chunk.Data.push_back(Devices::TFM::Register(rnd.Next(Devices::TFM::CHIPS), 0x20 + rnd.Next(0x98), rnd.Next(256)));
+      }
+      chip->RenderData(chunk);
+    }
+    return target->Result;
+  }
+
+  bool HasSound(const std::vector<Sound::Sample>& data)
+  {
+    return data.end() != std::find_if(data.begin(), data.end(), [](Sound::Sample smp) {return smp.Left() != Sound::Sample::MID;});
+  }
+
+  void TestResult(const std::string& device, const std::vector<Sound::Sample>& serial, const std::vector<Sound::Sample>& parallel)
+  {
+    Test(device + " rendering", HasSound(serial));
+    Test(device + " serial vs parallel size", serial.size() == parallel.size());
+    Test(device + " serial vs parallel output", serial == parallel);
+  }
+
+  void TestTasksOnError()
+  {
+    Devices::Details::ParallelTasks tasks;
+    std::atomic<bool> finished(false);
+    bool thrown = false;
+    try
+    {
+      tasks.Execute([&finished]()
+        {
+          std::this_thread::sleep_for(std::chrono::milliseconds(100));
+          finished = true;
+        },
+        []() {throw std::runtime_error("foreground");});
+    }
+    catch (const std::runtime_error&)
+    {
+      thrown = true;
+    }
+    Test("foreground error is rethrown", thrown);
+    Test("background task is finished on foreground error", finished);
+  }
+}
+
+int main()
+{
+  try
+  {
+    TestResult("TurboSound", RenderTurboSound(false, false), RenderTurboSound(true, false));
+    TestResult("TurboSound blocks", RenderTurboSound(false, true), RenderTurboSound(true, true));
+    TestResult("TurboFM", RenderTurboFM(false), RenderTurboFM(true));
+    TestTasksOnError();
+    return 0;
+  }
+  catch (int code)
+  {
+    return code;
+  }
+}
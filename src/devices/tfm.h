@@ -78,5 +78,7 @@ namespace Devices
 
     using FM::ChipParameters;
     Chip::Ptr CreateChip(ChipParameters::Ptr params, Sound::Receiver::Ptr target);
+    /// Same as CreateChip, but both chips are rendered concurrently
+    Chip::Ptr CreateParallelChip(ChipParameters::Ptr params, Sound::Receiver::Ptr target);
   }
 }
@@ -51,11 +51,16 @@ namespace Devices
     {
     public:
       typedef std::shared_ptr<Chip> Ptr;
+
+      /// @see AYM::Chip::RenderBlock
+      virtual void RenderBlock(const DataChunk* begin, const DataChunk* end, Sound::Chunk& target) = 0;
     };
 
     using AYM::ChipParameters;
     using AYM::MixerType;
 
     Chip::Ptr CreateChip(ChipParameters::Ptr params, MixerType::Ptr mixer, Sound::Receiver::Ptr target);
+    /// Same as CreateChip, but both chips are rendered concurrently
+    Chip::Ptr CreateParallelChip(ChipParameters::Ptr params, MixerType::Ptr mixer, Sound::Receiver::Ptr target);
   }
 }
@@ -111,10 +111,16 @@ namespace Z80
       const bool isLimited = Memory.size() < 65536;
       const z80ex_mread_cb read = isLimited ? &ReadByteLimited : &ReadByteUnlimited;
       const z80ex_mwrite_cb write = isLimited ? &WriteByteLimited : &WriteByteUnlimited;
-      return std::shared_ptr<Z80EX_CONTEXT>(
+      const std::shared_ptr<Z80EX_CONTEXT> result(
         z80ex_create(read, self, write, self,
                      &InByte, self, &OutByte, self,
                      &IntRead, self), std::ptr_fun(&z80ex_destroy));
+      if (!isLimited)
+      {
+        //whole address space is backed by plain memory, so access it inline, only ports use callbacks
+        z80ex_set_memory(result.get(), RawMemory);
+      }
+      return result;
     }
   private:
     static Z80EX_BYTE ReadByteUnlimited(Z80EX_CONTEXT* /*cpu*/, Z80EX_WORD addr, int /*m1_state*/, void* userData)
@@ -46,4 +46,9 @@ namespace IO
   //! @param %Parameters accessor
   //! @param cb Callback for long-time operations
   Binary::OutputStream::Ptr CreateStream(const String& path, const Parameters::Accessor& params, Log::ProgressCallback& cb);
+
+  //! @brief Hints that specified uri is going to be opened soon
+  //! @param path External data identifier
+  //! @note Starts background reading if supported by provider. Never blocks or throws
+  void PrefetchData(const String& path);
 }
@@ -32,6 +32,7 @@ namespace Parameters
           extern const NameType CREATE_DIRECTORIES = PREFIX + "create_directories";
           extern const NameType OVERWRITE_EXISTING = PREFIX + "overwrite";
           extern const NameType SANITIZE_NAMES = PREFIX + "sanitize";
+          extern const NameType WRITE_BUFFER_SIZE = PREFIX + "write_buffer_size";
         }
 
         namespace Network
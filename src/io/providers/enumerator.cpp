@@ -97,6 +97,17 @@ namespace IO
       throw Error(THIS_LINE, translate("Specified uri scheme is not supported."));
     }
 
+    void PrefetchData(const String& path) const override
+    {
+      if (Identifier::Ptr id = Resolve(path))
+      {
+        if (const DataProvider* provider = FindProvider(id->Scheme()))
+        {
+          provider->Prefetch(id->Path());
+        }
+      }
+    }
+
     Provider::Iterator::Ptr Enumerate() const override
     {
       return MakePtr<RangedObjectIteratorAdapter<ProvidersList::const_iterator, Provider::Ptr> >(Providers.begin(), Providers.end());
@@ -167,6 +178,10 @@ namespace IO
       throw Error(THIS_LINE, translate("Specified uri scheme is not supported."));
     }
 
+    void Prefetch(const String&) const override
+    {
+    }
+
     Strings::Set Schemes() const override
     {
       return Strings::Set();
@@ -206,6 +221,11 @@ namespace IO
     return ProvidersEnumerator::Instance().CreateStream(path, params, cb);
   }
 
+  void PrefetchData(const String& path)
+  {
+    ProvidersEnumerator::Instance().PrefetchData(path);
+  }
+
   Provider::Iterator::Ptr EnumerateProviders()
   {
     return ProvidersEnumerator::Instance().Enumerate();
@@ -27,6 +27,7 @@ namespace IO
     virtual Identifier::Ptr Resolve(const String& uri) const = 0;
     virtual Binary::Container::Ptr Open(const String& path, const Parameters::Accessor& parameters, Log::ProgressCallback& callback) const = 0;
     virtual Binary::OutputStream::Ptr Create(const String& path, const Parameters::Accessor& params, Log::ProgressCallback& callback) const = 0;
+    virtual void Prefetch(const String& path) const = 0;
   };
 
   // internal enumerator interface
@@ -43,6 +44,8 @@ namespace IO
 
     virtual Binary::OutputStream::Ptr CreateStream(const String& path, const Parameters::Accessor& params, Log::ProgressCallback& cb) const = 0;
 
+    virtual void PrefetchData(const String& path) const = 0;
+
     virtual Provider::Iterator::Ptr Enumerate() const = 0;
 
     static ProvidersEnumerator& Instance();
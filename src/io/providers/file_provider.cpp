@@ -19,13 +19,18 @@
 //library includes
 #include <binary/container_factories.h>
 #include <debug/log.h>
+#include <debug/metrics.h>
 #include <io/providers_parameters.h>
 #include <l10n/api.h>
 #include <parameters/accessor.h>
 #include <strings/encoding.h>
 #include <strings/format.h>
 //std includes
+#include <algorithm>
 #include <cctype>
+#include <deque>
+#include <mutex>
+#include <vector>
 //boost includes
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/filesystem/fstream.hpp>
@@ -35,6 +40,11 @@
 #include <boost/interprocess/mapped_region.hpp>
 //text includes
 #include <io/text/io.h>
+//platform-specific includes
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 #define FILE_TAG 0D4CB3DA
 
@@ -126,6 +136,18 @@ namespace IO
       Accessor.FindValue(Parameters::ZXTune::IO::Providers::File::SANITIZE_NAMES, intVal);
       return intVal != 0;
     }
+
+    std::size_t WriteBufferSize() const override
+    {
+      Parameters::IntType intVal = Parameters::ZXTune::IO::Providers::File::WRITE_BUFFER_SIZE_DEFAULT;
+      const bool found = Accessor.FindValue(Parameters::ZXTune::IO::Providers::File::WRITE_BUFFER_SIZE, intVal);
+      if (found && (intVal < 0 || intVal > Parameters::ZXTune::IO::Providers::File::WRITE_BUFFER_SIZE_MAX))
+      {
+        throw MakeFormattedError(THIS_LINE,
+          translate("Invalid write buffer size (%1%)."), intVal);
+      }
+      return static_cast<std::size_t>(intVal);
+    }
   private:
     const Parameters::Accessor& Accessor;
   };
@@ -296,8 +318,105 @@ namespace IO
     }
   }
 
+  /*
+    Files are hinted to be read by kernel in background while previous ones are being processed,
+    so actual opening finds data in page cache. Hits and misses are tracked to estimate efficiency.
+  */
+  class PrefetchTracker
+  {
+  public:
+    PrefetchTracker()
+      : Hits()
+      , Misses()
+      , HitsMetric("zxtune_io_prefetch_hits_total")
+      , MissesMetric("zxtune_io_prefetch_misses_total")
+    {
+    }
+
+    ~PrefetchTracker()
+    {
+      if (Hits || Misses)
+      {
+        Dbg("Prefetch statistic: %1% hits, %2% misses", Hits, Misses);
+      }
+    }
+
+    static PrefetchTracker& Instance()
+    {
+      static PrefetchTracker self;
+      return self;
+    }
+
+    void Prefetch(const String& path)
+    {
+      if (!StartReading(path))
+      {
+        return;
+      }
+      const std::lock_guard<std::mutex> lock(Guard);
+      Pending.push_back(path);
+      if (Pending.size() > MAX_PENDING)
+      {
+        Pending.pop_front();
+      }
+    }
+
+    void Opened(const String& path)
+    {
+      const std::lock_guard<std::mutex> lock(Guard);
+      if (Pending.empty() && !Hits && !Misses)
+      {
+        //prefetching is not used at all
+        return;
+      }
+      const auto it = std::find(Pending.begin(), Pending.end(), path);
+      if (it != Pending.end())
+      {
+        Pending.erase(it);
+        ++Hits;
+        HitsMetric.Add();
+      }
+      else
+      {
+        ++Misses;
+        MissesMetric.Add();
+        Dbg("Prefetch missed for '%1%'", path);
+      }
+    }
+  private:
+    static bool StartReading(const String& path)
+    {
+#ifdef __linux__
+      //use local encoding here
+      const int fd = ::open(Details::FromString(path).c_str(), O_RDONLY);
+      if (fd == -1)
+      {
+        return false;
+      }
+      //whole file, returns immediately
+      const bool res = 0 == ::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+      ::close(fd);
+      return res;
+#else
+      Dbg("Prefetching '%1%' is not supported", path);
+      return false;
+#endif
+    }
+  private:
+    //bigger than any sane read-ahead window
+    static const std::size_t MAX_PENDING = 64;
+
+    std::mutex Guard;
+    std::deque<String> Pending;
+    uint_t Hits;
+    uint_t Misses;
+    const Debug::Metrics::Counter HitsMetric;
+    const Debug::Metrics::Counter MissesMetric;
+  };
+
   Binary::Data::Ptr OpenFileData(const String& path, std::size_t mmapThreshold)
   {
+    PrefetchTracker::Instance().Opened(path);
     const boost::filesystem::path fileName = Details::FromString(path);
     const boost::uintmax_t size = FileSize(fileName, THIS_LINE);
     if (size == 0)
@@ -318,13 +437,27 @@ namespace IO
     }
   }
 
+  /*
+    Rendered data is usually written by small portions (e.g. per frame), so big buffer
+    significantly decreases system calls count, especially for network file systems.
+    Bigger portions are passed to file system directly.
+    No space preallocation is performed: final size is unknown at creation (encoders' output size
+    depends on content), and blocks preallocated past the end of file are kept allocated until truncation.
+    Buffered portions are already allocated contiguously by delayed allocation of modern file systems.
+  */
   class OutputFileStream : public Binary::SeekableOutputStream
   {
   public:
-    explicit OutputFileStream(const boost::filesystem::path& name)
+    OutputFileStream(const boost::filesystem::path& name, std::size_t bufferSize)
       : Name(Details::ToString(name))
-      , Stream(name, std::ios::binary | std::ios_base::out)
+      , Buffer(bufferSize)
     {
+      //buffer should be set before opening
+      if (!Buffer.empty())
+      {
+        Stream.rdbuf()->pubsetbuf(&Buffer.front(), Buffer.size());
+      }
+      Stream.open(name, std::ios::binary | std::ios_base::out);
       if (!Stream)
       {
         throw Error(THIS_LINE, translate("Failed to open file."));
@@ -361,6 +494,7 @@ namespace IO
     }
   private:
     const String Name;
+    std::vector<char> Buffer;
     boost::filesystem::ofstream Stream;
   };
 
@@ -407,7 +541,7 @@ namespace IO
     return result;
   }
 
-  Binary::SeekableOutputStream::Ptr CreateFileStream(const String& fileName, const FileCreatingParameters& params)
+  boost::filesystem::path ResolveFilePath(const String& fileName, const FileCreatingParameters& params)
   {
     try
     {
@@ -445,7 +579,7 @@ namespace IO
       default:
         Require(false);
       }
-      return MakePtr<OutputFileStream>(path);
+      return path;
     }
     catch (const boost::system::system_error& err)
     {
@@ -507,6 +641,11 @@ namespace IO
       const FileProviderParameters parameters(params);
       return CreateLocalFile(path, parameters);
     }
+
+    void Prefetch(const String& path) const override
+    {
+      PrefetchLocalFile(path);
+    }
   };
 }
 
@@ -524,11 +663,16 @@ namespace IO
     }
   }
 
-  Binary::SeekableOutputStream::Ptr CreateLocalFile(const String& path, const FileCreatingParameters& params)
+  void PrefetchLocalFile(const String& path)
+  {
+    PrefetchTracker::Instance().Prefetch(path);
+  }
+
+  String ResolveLocalFilePath(const String& path, const FileCreatingParameters& params)
   {
     try
     {
-      return CreateFileStream(path, params);
+      return Details::ToString(ResolveFilePath(path, params));
     }
     catch (const Error& e)
     {
@@ -536,6 +680,27 @@ namespace IO
     }
   }
 
+  Binary::SeekableOutputStream::Ptr CreateLocalFile(const String& path, const FileCreatingParameters& params, String& actualPath)
+  {
+    try
+    {
+      const boost::filesystem::path resolved = ResolveFilePath(path, params);
+      auto result = MakePtr<OutputFileStream>(resolved, params.WriteBufferSize());
+      actualPath = Details::ToString(resolved);
+      return result;
+    }
+    catch (const Error& e)
+    {
+      throw MakeFormattedError(THIS_LINE, translate("Failed to create file '%1%'."), path).AddSuberror(e);
+    }
+  }
+
+  Binary::SeekableOutputStream::Ptr CreateLocalFile(const String& path, const FileCreatingParameters& params)
+  {
+    String actualPath;
+    return CreateLocalFile(path, params, actualPath);
+  }
+
   DataProvider::Ptr CreateFileDataProvider()
   {
     return MakePtr<FileDataProvider>();
@@ -23,6 +23,9 @@ namespace IO
 {
   Binary::Data::Ptr OpenLocalFile(const String& path, std::size_t mmapThreshold);
 
+  //! @brief Starts background reading of specified file to speedup subsequent OpenLocalFile call
+  void PrefetchLocalFile(const String& path);
+
   enum OverwriteMode
   {
     STOP_IF_EXISTS,
@@ -38,7 +41,15 @@ namespace IO
     virtual OverwriteMode Overwrite() const = 0;
     virtual bool CreateDirectories() const = 0;
     virtual bool SanitizeNames() const = 0;
+    virtual std::size_t WriteBufferSize() const = 0;
   };
 
   Binary::SeekableOutputStream::Ptr CreateLocalFile(const String& path, const FileCreatingParameters& params);
+
+  //! @brief Same as CreateLocalFile, additionally reports path of really created file (after sanitizing and renaming)
+  Binary::SeekableOutputStream::Ptr CreateLocalFile(const String& path, const FileCreatingParameters& params, String& actualPath);
+
+  //! @brief Applies the same names sanitizing, directories creating and overwriting policy as CreateLocalFile does
+  //! @return path the file should be created at
+  String ResolveLocalFilePath(const String& path, const FileCreatingParameters& params);
 }
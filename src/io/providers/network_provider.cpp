@@ -368,6 +368,10 @@ namespace IO
     {
       throw Error(THIS_LINE, translate("Not supported."));
     }
+
+    void Prefetch(const String& /*path*/) const override
+    {
+    }
   private:
     const Curl::Api::Ptr Api;
     const Strings::Set SupportedSchemes;
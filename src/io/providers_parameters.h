@@ -64,6 +64,18 @@ namespace Parameters
           const IntType SANITIZE_NAMES_DEFAULT = 1;
           //! @Parameter full path
           extern const NameType SANITIZE_NAMES;
+          //@}
+
+          //@{
+          //! @name Size of buffer to accumulate written data before passing to file system. 0 to use default one
+
+          //! Default value
+          const IntType WRITE_BUFFER_SIZE_DEFAULT = 65536;
+          //! Maximal value
+          const IntType WRITE_BUFFER_SIZE_MAX = 16777216;
+          //! @Parameter full path
+          extern const NameType WRITE_BUFFER_SIZE;
+          //@}
         }
 
         //! @brief %Network provider parameters namespace
@@ -125,6 +125,13 @@ int main()
     params->SetValue(Parameters::ZXTune::IO::Providers::File::OVERWRITE_EXISTING, OVERWRITE_EXISTING);
     Test(CreateData(fileName, *params), "Overwrite file", __LINE__);
     Test(CreateData(nestedFile, *params), "Overwrite file with intermediate dirs", __LINE__);
+    params->SetValue(Parameters::ZXTune::IO::Providers::File::WRITE_BUFFER_SIZE, -1);
+    CheckError(CreateData(fileName, *params), "Create file with negative buffer size", __LINE__);
+    params->SetValue(Parameters::ZXTune::IO::Providers::File::WRITE_BUFFER_SIZE, Parameters::ZXTune::IO::Providers::File::WRITE_BUFFER_SIZE_MAX + 1);
+    CheckError(CreateData(fileName, *params), "Create file with too big buffer size", __LINE__);
+    params->SetValue(Parameters::ZXTune::IO::Providers::File::WRITE_BUFFER_SIZE, 0);
+    Test(CreateData(fileName, *params), "Create file with default buffer", __LINE__);
+    params->SetValue(Parameters::ZXTune::IO::Providers::File::WRITE_BUFFER_SIZE, Parameters::ZXTune::IO::Providers::File::WRITE_BUFFER_SIZE_DEFAULT);
     params->SetValue(Parameters::ZXTune::IO::Providers::File::OVERWRITE_EXISTING, RENAME_NEW);
     for (uint_t retry = 0; retry != 3; ++retry)
     {
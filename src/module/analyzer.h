@@ -14,6 +14,7 @@
 #include <types.h>
 //std includes
 #include <memory>
+#include <vector>
 
 namespace Module
 {
@@ -32,6 +33,25 @@ namespace Module
       uint_t Level;
     };
 
-    virtual std::vector<ChannelState> GetState() const = 0;
+    //! @brief Appends current channels state to @p result
+    //! @note Caller keeps storage between calls, so polling does not allocate after capacity is reached
+    virtual void GetState(std::vector<ChannelState>& result) const = 0;
   };
+
+  /*
+    @brief Analyzer with state published by rendering thread
+
+    Snapshots are passed via lock-free triple buffer, so consumer never waits for producer
+    and never calls source analyzer concurrently with rendering. Single producer and single consumer are supported.
+  */
+  class PublishedAnalyzer : public Analyzer
+  {
+  public:
+    typedef std::shared_ptr<PublishedAnalyzer> Ptr;
+
+    //! @brief Take snapshot of source analyzer state. Called from rendering thread after each frame
+    virtual void Publish() = 0;
+  };
+
+  PublishedAnalyzer::Ptr CreatePublishedAnalyzer(Analyzer::Ptr source);
 }
@@ -0,0 +1,28 @@
+/**
+*
+* @file
+*
+* @brief  Module::Renderer extension for fast forwarding
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+#pragma once
+
+//common includes
+#include <types.h>
+
+namespace Module
+{
+  //! @brief Cheap frames skipping without sound synthesis
+  class FastForward
+  {
+  public:
+    virtual ~FastForward() = default;
+
+    //! @brief Advance playback state by specified frames count without rendering
+    //! @return true if next frame can be rendered, same as Renderer::RenderFrame
+    virtual bool SkipFrames(uint_t count) = 0;
+  };
+}
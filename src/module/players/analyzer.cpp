@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <array>
 #include <complex>
+#include <iterator>
 #include <utility>
 
 namespace Module
@@ -30,13 +31,13 @@ namespace Module
     {
     }
 
-    std::vector<ChannelState> GetState() const override
+    void GetState(std::vector<ChannelState>& result) const override
     {
-      const auto& in = Delegate->GetState();
-      std::vector<ChannelState> out(in.size());
-      std::transform(in.begin(), in.end(), out.begin(), &ConvertState);
-      //required by compiler
-      return std::move(out);
+      //owned by calling thread, so it's reused without allocations and locking even if called from several threads
+      static thread_local Devices::MultiChannelState devices;
+      devices.clear();
+      Delegate->GetState(devices);
+      std::transform(devices.begin(), devices.end(), std::back_inserter(result), &ConvertState);
     }
   private:
     static ChannelState ConvertState(const Devices::ChannelState& in)
@@ -76,11 +77,9 @@ namespace Module
       }
     }
     
-    std::vector<ChannelState> GetState() const override
+    void GetState(std::vector<ChannelState>& result) const override
     {
       static const uint_t BANDS = 96;
-      std::vector<ChannelState> result;
-      result.reserve(BANDS);
       const auto& levels = FFT<BANDS>();
       ChannelState res;
       for (res.Band = 0; res.Band < BANDS; ++res.Band)
@@ -92,7 +91,6 @@ namespace Module
         }
       }
       Active = true;
-      return result;
     }
   private:
     using Complex = std::complex<float>;
@@ -20,6 +20,7 @@
 #include <devices/beeper.h>
 #include <devices/z80.h>
 #include <formats/chiptune/emulation/ay.h>
+#include <module/fast_forward.h>
 #include <module/players/duration.h>
 #include <module/players/properties_helper.h>
 #include <module/players/streaming.h>
@@ -50,6 +51,7 @@ namespace AYEMUL
       Register = 0;
       Chunks.clear();
       State = Devices::AYM::DataChunk();
+      Skipped = Devices::AYM::Registers();
       Blocked = false;
     }
 
@@ -58,6 +60,15 @@ namespace AYEMUL
       Blocked = block;
     }
 
+    void FlushSkipped(const Devices::AYM::Stamp& timeStamp)
+    {
+      if (!Skipped.Empty())
+      {
+        AllocateChunk(timeStamp).Data = Skipped;
+        Skipped = Devices::AYM::Registers();
+      }
+    }
+
     bool SelectRegister(uint_t reg)
     {
       Register = reg;
@@ -69,9 +80,14 @@ namespace AYEMUL
       if (IsRegisterSelected())
       {
         const Devices::AYM::Registers::Index idx = static_cast<Devices::AYM::Registers::Index>(Register);
-        if (Devices::AYM::DataChunk* chunk = GetChunk(timeStamp))
+        if (Blocked)
         {
-          chunk->Data[idx] = val;
+          //keep only final values of registers written while skipping
+          Skipped[idx] = val;
+        }
+        else
+        {
+          AllocateChunk(timeStamp).Data[idx] = val;
         }
         State.Data[idx] = val;
         return true;
@@ -108,13 +124,6 @@ namespace AYEMUL
       return Register < Devices::AYM::Registers::TOTAL;
     }
     
-    Devices::AYM::DataChunk* GetChunk(const Devices::AYM::Stamp& timeStamp)
-    {
-      return Blocked
-        ? nullptr
-        : &AllocateChunk(timeStamp);
-    }
-
     Devices::AYM::DataChunk& AllocateChunk(const Devices::AYM::Stamp& timeStamp)
     {
       Chunks.resize(Chunks.size() + 1);          
@@ -127,6 +136,7 @@ namespace AYEMUL
     uint_t Register;
     std::vector<Devices::AYM::DataChunk> Chunks;
     Devices::AYM::DataChunk State;
+    Devices::AYM::Registers Skipped;
     bool Blocked;
   };
   
@@ -208,10 +218,17 @@ namespace AYEMUL
       Beeper.Reset();
     }
     
-    void SetBlocked(bool block)
+    void StartFastForward()
     {
-      Ay.SetBlocked(block);
-      Beeper.SetBlocked(block);
+      Ay.SetBlocked(true);
+      Beeper.SetBlocked(true);
+    }
+
+    void StopFastForward(const Devices::Z80::Stamp& timeStamp)
+    {
+      Ay.SetBlocked(false);
+      Ay.FlushSkipped(timeStamp);
+      Beeper.SetBlocked(false);
     }
 
     bool SelectAyRegister(uint_t reg)
@@ -400,9 +417,14 @@ namespace AYEMUL
       CPC.Reset();
     }
 
-    void SetBlocked(bool blocked)
+    void StartFastForward()
+    {
+      Channel->StartFastForward();
+    }
+
+    void StopFastForward(const Devices::Z80::Stamp& timeStamp)
     {
-      Channel->SetBlocked(blocked);
+      Channel->StopFastForward(timeStamp);
     }
 
     uint8_t Read(uint16_t port) override
@@ -535,15 +557,15 @@ namespace AYEMUL
     void SkipFrames(uint_t count, const Devices::Z80::Stamp& frameStep)
     {
       const Devices::Z80::Stamp curTime = CPU->GetTime();
-      CPUPorts->SetBlocked(true);
+      CPUPorts->StartFastForward();
       Devices::Z80::Stamp pos = curTime;
       for (uint_t frame = 0; frame < count; ++frame)
       {
         pos += frameStep;
         NextFrame(pos);
       }
-      CPUPorts->SetBlocked(false);
       CPU->SetTime(curTime);
+      CPUPorts->StopFastForward(curTime);
     }
   private:
     const ModuleData::Ptr Data;
@@ -553,6 +575,7 @@ namespace AYEMUL
   };
 
   class Renderer : public Module::Renderer
+                 , public Module::FastForward
   {
   public:
     Renderer(Sound::RenderParameters::Ptr params, StateIterator::Ptr iterator, Computer::Ptr comp, DataChannel::Ptr device)
@@ -612,14 +635,14 @@ namespace AYEMUL
         curFrame = 0;
       }
       SynchronizeParameters();
-      uint_t toSkip = 0;
-      while (curFrame < frameNum && Iterator->IsValid())
-      {
-        Iterator->NextFrame(true);
-        ++curFrame;
-        ++toSkip;
-      }
-      Comp->SkipFrames(toSkip, FrameDuration);
+      Skip(frameNum - curFrame, true);
+    }
+
+    bool SkipFrames(uint_t count) override
+    {
+      SynchronizeParameters();
+      Skip(count, Looped);
+      return Iterator->IsValid();
     }
   private:
     void SynchronizeParameters()
@@ -630,6 +653,17 @@ namespace AYEMUL
         Looped = Params->Looped();
       }
     }
+
+    void Skip(uint_t count, bool looped)
+    {
+      uint_t toSkip = 0;
+      while (toSkip < count && Iterator->IsValid())
+      {
+        Iterator->NextFrame(looped);
+        ++toSkip;
+      }
+      Comp->SkipFrames(toSkip, FrameDuration);
+    }
   private:
     Parameters::TrackingHelper<Sound::RenderParameters> Params;
     const StateIterator::Ptr Iterator;
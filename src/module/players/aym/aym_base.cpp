@@ -161,9 +161,8 @@ namespace Module
   class StubAnalyzer : public Module::Analyzer
   {
   public:
-    std::vector<Module::Analyzer::ChannelState> GetState() const override
+    void GetState(std::vector<Module::Analyzer::ChannelState>& /*result*/) const override
     {
-      return {};
     }
   };
 }
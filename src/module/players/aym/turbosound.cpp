@@ -15,6 +15,7 @@
 #include <iterator.h>
 #include <make_ptr.h>
 //library includes
+#include <core/core_parameters.h>
 #include <module/attributes.h>
 #include <module/players/analyzer.h>
 #include <parameters/merged_accessor.h>
@@ -536,7 +537,11 @@ namespace TurboSound
     const MixerType::Ptr mixer = MixerType::Create();
     const Parameters::Accessor::Ptr pollParams = Sound::CreateMixerNotificationParameters(params, mixer);
     const Devices::TurboSound::ChipParameters::Ptr chipParams = AYM::CreateChipParameters(pollParams);
-    return Devices::TurboSound::CreateChip(chipParams, mixer, target);
+    Parameters::IntType parallel = Parameters::ZXTune::Core::PARALLEL_CHIPS_DEFAULT;
+    params->FindValue(Parameters::ZXTune::Core::PARALLEL_CHIPS, parallel);
+    return parallel != Parameters::ZXTune::Core::PARALLEL_CHIPS_DISABLED
+      ? Devices::TurboSound::CreateParallelChip(chipParams, mixer, target)
+      : Devices::TurboSound::CreateChip(chipParams, mixer, target);
   }
 
   DataIterator::Ptr CreateDataIterator(const TrackParametersArray& trackParams, TrackStateIterator::Ptr iterator,
@@ -190,10 +190,8 @@ namespace AHX
     {
     }
 
-    std::vector<ChannelState> GetState() const override
+    void GetState(std::vector<ChannelState>& result) const override
     {
-      std::vector<ChannelState> result;
-      result.reserve(Hvl->ht_Channels);
       for (uint_t idx = 0, lim = Hvl->ht_Channels; idx != lim; ++idx)
       {
         const hvl_voice& voice = Hvl->ht_Voices[idx];
@@ -205,7 +203,6 @@ namespace AHX
           result.push_back(state);
         }
       }
-      return result;
     }
   private:
     const HvlPtr Hvl;
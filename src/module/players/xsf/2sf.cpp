@@ -127,11 +127,9 @@ namespace TwoSF
       ::state_render(&State, nullptr, samples);
     }
 
-    std::vector<ChannelState> GetState() const override
+    void GetState(std::vector<ChannelState>& result) const override
     {
       static const AnalysisMap ANALYSIS;
-      std::vector<ChannelState> result;
-      result.reserve(16);
       for (const auto& in : State.SPU_core->channels)
       {
         if (in.status == CHANSTAT_STOPPED)
@@ -146,7 +144,6 @@ namespace TwoSF
           result.push_back(out);
         }
       }
-      return result;
     }
   private:
     void SetupEnvironment(const XSF::MetaInformation& meta)
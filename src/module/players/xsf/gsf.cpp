@@ -11,6 +11,7 @@
 //local includes
 #include "gsf.h"
 #include "gsf_rom.h"
+#include "library_cache.h"
 #include "xsf.h"
 #include "xsf_factory.h"
 //common includes
@@ -134,8 +135,15 @@ namespace GSF
       Core->init(Core);
       mCoreInitConfig(Core, NULL);
       //core owns rom file memory, so copy it
-      const auto romFile = VFileMemChunk(rom.Content.Data.data(), rom.Content.Data.size());
+      const auto romFile = VFileMemChunk(nullptr, rom.Content.Size());
       Require(romFile != 0);
+      const auto romStart = rom.Content.Start();
+      rom.Content.ForEachChunk([romFile, romStart](uint_t addr, const uint8_t* data, std::size_t size)
+      {
+        romFile->seek(romFile, addr - romStart, SEEK_SET);
+        romFile->write(romFile, data, size);
+      });
+      romFile->seek(romFile, 0, SEEK_SET);
       Core->loadROM(Core, romFile);
       Reset();
     }
@@ -218,9 +226,8 @@ namespace GSF
       }
     }
 
-    std::vector<ChannelState> GetState() const override
+    void GetState(std::vector<ChannelState>& /*result*/) const override
     {
-      return std::vector<ChannelState>();
     }
   private:
     GbaCore Core;
@@ -372,6 +379,17 @@ namespace GSF
       GbaRom::Parse(*unpackedSection, *Rom);
     }
 
+    void AddLibraryRom(Binary::Data::Ptr packedSection)
+    {
+      Require(!!packedSection);
+      if (!Rom)
+      {
+        Rom = MakeRWPtr<GbaRom>();
+      }
+      const auto image = XSF::LibraryCache<GbaRom>::Get(std::move(packedSection), &DecodeRom);
+      Rom->Superimpose(*image);
+    }
+
     void AddMeta(const XSF::MetaInformation& meta)
     {
       if (!Meta)
@@ -391,6 +409,14 @@ namespace GSF
       res->Meta = std::move(Meta);
       return res;
     }
+  private:
+    static std::shared_ptr<const GbaRom> DecodeRom(Binary::Data::Ptr packedSection)
+    {
+      const auto unpackedSection = Binary::Compression::Zlib::CreateDeferredDecompressContainer(std::move(packedSection));
+      auto result = std::make_shared<GbaRom>();
+      GbaRom::Parse(*unpackedSection, *result);
+      return result;
+    }
   private:
     GbaRom::RWPtr Rom;
     XSF::MetaInformation::RWPtr Meta;
@@ -414,7 +440,7 @@ namespace GSF
     Holder::Ptr CreateMultifileModule(const XSF::File& file, const std::map<String, XSF::File>& additionalFiles, Parameters::Container::Ptr properties) const
     {
       ModuleDataBuilder builder;
-      MergeRom(file, additionalFiles, builder);
+      MergeRom(file, additionalFiles, false, builder);
       MergeMeta(file, additionalFiles, builder);
       return Holder::Create(builder.CaptureResult(), std::move(properties));
     }
@@ -425,20 +451,27 @@ namespace GSF
     now supported.
 
     */
-    static void MergeRom(const XSF::File& data, const std::map<String, XSF::File>& additionalFiles, ModuleDataBuilder& dst)
+    static void MergeRom(const XSF::File& data, const std::map<String, XSF::File>& additionalFiles, bool isLibrary, ModuleDataBuilder& dst)
     {
       auto it = data.Dependencies.begin();
       const auto lim = data.Dependencies.end();
       if (it != lim)
       {
-        MergeRom(additionalFiles.at(*it), additionalFiles, dst);
+        MergeRom(additionalFiles.at(*it), additionalFiles, true, dst);
+      }
+      if (isLibrary)
+      {
+        dst.AddLibraryRom(data.PackedProgramSection);
+      }
+      else
+      {
+        dst.AddRom(data.PackedProgramSection);
       }
-      dst.AddRom(data.PackedProgramSection);
       if (it != lim)
       {
         for (++it; it != lim; ++it)
         {
-          MergeRom(additionalFiles.at(*it), additionalFiles, dst);
+          MergeRom(additionalFiles.at(*it), additionalFiles, true, dst);
         }
       }
     }
@@ -49,5 +49,14 @@ namespace Module
       RomParser parser(rom);
       Formats::Chiptune::GameBoyAdvanceSoundFormat::ParseRom(data, parser);
     }
+
+    void GbaRom::Superimpose(const GbaRom& rh)
+    {
+      if (!EntryPoint)
+      {
+        EntryPoint = rh.EntryPoint;
+      }
+      Content.Update(rh.Content);
+    }
   }
 }
@@ -34,9 +34,12 @@ namespace Module
       GbaRom& operator = (const GbaRom&) = delete;
       
       uint32_t EntryPoint = 0;
-      MemoryRegion Content;
+      PagedMemoryRegion Content;
       
       static void Parse(const Binary::Container& data, GbaRom& rom);
+
+      //! @brief Apply another image on top of current one using the same rules as Parse does
+      void Superimpose(const GbaRom& rh);
     };
   }
 }
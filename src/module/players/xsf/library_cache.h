@@ -0,0 +1,122 @@
+/**
+*
+* @file
+*
+* @brief  Xsf-based files common code. Decoded libraries cache
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+#pragma once
+
+//common includes
+#include <crc.h>
+//library includes
+#include <binary/data.h>
+#include <debug/metrics.h>
+//std includes
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+
+namespace Module
+{
+  namespace XSF
+  {
+    /*
+      Sets usually consist of many small tracks referencing the same big library file.
+      Decoded library images are shared between tracks, so each track switch only decodes
+      its own program section and superimposes it onto the image. Image pages are copied
+      only when overwritten by track.
+    */
+    template<class ImageType>
+    class LibraryCache
+    {
+    public:
+      using ImagePtr = std::shared_ptr<const ImageType>;
+
+      //! @brief Find decoded image for specified packed content or decode it with @p decoder
+      //! @param decoder callable with signature ImagePtr(Binary::Data::Ptr packed)
+      template<class DecoderType>
+      static ImagePtr Get(Binary::Data::Ptr packed, const DecoderType& decoder)
+      {
+        static LibraryCache instance;
+        return instance.GetImage(std::move(packed), decoder);
+      }
+    private:
+      LibraryCache()
+        : HitsMetric("zxtune_xsf_library_cache_hits_total")
+        , MissesMetric("zxtune_xsf_library_cache_misses_total")
+      {
+      }
+
+      template<class DecoderType>
+      ImagePtr GetImage(Binary::Data::Ptr packed, const DecoderType& decoder)
+      {
+        const auto hash = Crc32(static_cast<const uint8_t*>(packed->Start()), packed->Size());
+        if (auto cached = Find(hash, *packed))
+        {
+          HitsMetric.Add();
+          return cached;
+        }
+        MissesMetric.Add();
+        //decode without lock, concurrent decoding of the same library is harmless
+        auto image = decoder(packed);
+        const std::lock_guard<std::mutex> lock(Guard);
+        //the same library may be decoded and stored concurrently, so keep single entry
+        if (auto cached = FindUnlocked(hash, *packed))
+        {
+          return cached;
+        }
+        Entries.push_front(Entry{hash, std::move(packed), image});
+        if (Entries.size() > MAX_ENTRIES)
+        {
+          Entries.pop_back();
+        }
+        return image;
+      }
+
+      ImagePtr Find(uint32_t hash, const Binary::Data& packed)
+      {
+        const std::lock_guard<std::mutex> lock(Guard);
+        return FindUnlocked(hash, packed);
+      }
+
+      ImagePtr FindUnlocked(uint32_t hash, const Binary::Data& packed)
+      {
+        for (auto it = Entries.begin(), lim = Entries.end(); it != lim; ++it)
+        {
+          if (it->Matches(hash, packed))
+          {
+            Entries.splice(Entries.begin(), Entries, it);
+            return it->Image;
+          }
+        }
+        return ImagePtr();
+      }
+    private:
+      struct Entry
+      {
+        uint32_t Hash;
+        Binary::Data::Ptr Packed;
+        ImagePtr Image;
+
+        bool Matches(uint32_t hash, const Binary::Data& packed) const
+        {
+          const auto size = packed.Size();
+          return Hash == hash && Packed->Size() == size && 0 == std::memcmp(Packed->Start(), packed.Start(), size);
+        }
+      };
+
+      //most recently used images are kept to survive switching between several sets
+      static const std::size_t MAX_ENTRIES = 4;
+
+      const Debug::Metrics::Counter HitsMetric;
+      const Debug::Metrics::Counter MissesMetric;
+      std::mutex Guard;
+      std::list<Entry> Entries;
+    };
+  }
+}
@@ -36,4 +36,94 @@ namespace Module
       Start = addr;
     }
   }
+
+  void PagedMemoryRegion::Update(uint_t addr, const void* data, std::size_t size)
+  {
+    if (!size)
+    {
+      return;
+    }
+    Extend(addr, addr + size);
+    const auto* src = static_cast<const uint8_t*>(data);
+    for (auto end = addr + size; addr < end; )
+    {
+      const auto pageIdx = (addr - FirstPageAddr) / PAGE_SIZE;
+      const auto pageAddr = FirstPageAddr + pageIdx * PAGE_SIZE;
+      const auto toCopy = std::min<uint_t>(pageAddr + PAGE_SIZE, end) - addr;
+      std::memcpy(GetWritablePage(pageIdx) + (addr - pageAddr), src, toCopy);
+      addr += toCopy;
+      src += toCopy;
+    }
+  }
+
+  void PagedMemoryRegion::Update(const PagedMemoryRegion& rh)
+  {
+    if (rh.Pages.empty())
+    {
+      return;
+    }
+    Extend(rh.StartAddr, rh.EndAddr);
+    for (auto addr = rh.StartAddr; addr < rh.EndAddr; )
+    {
+      const auto rhPageIdx = (addr - rh.FirstPageAddr) / PAGE_SIZE;
+      const auto pageAddr = rh.FirstPageAddr + rhPageIdx * PAGE_SIZE;
+      const auto pageIdx = (pageAddr - FirstPageAddr) / PAGE_SIZE;
+      const auto end = std::min<uint_t>(pageAddr + PAGE_SIZE, rh.EndAddr);
+      const auto& rhPage = rh.Pages[rhPageIdx];
+      if (end - addr == PAGE_SIZE)
+      {
+        Pages[pageIdx] = rhPage;
+      }
+      else
+      {
+        const auto offset = addr - pageAddr;
+        std::memcpy(GetWritablePage(pageIdx) + offset, (rhPage ? rhPage->data() : ZeroPage().data()) + offset, end - addr);
+      }
+      addr = end;
+    }
+  }
+
+  const PagedMemoryRegion::Page& PagedMemoryRegion::ZeroPage()
+  {
+    static const Page ZERO = {{}};
+    return ZERO;
+  }
+
+  //bytes of pages outside of [StartAddr, EndAddr) are always zero, so gaps are zero-filled as in MemoryRegion
+  void PagedMemoryRegion::Extend(uint_t start, uint_t end)
+  {
+    const auto firstPage = start & ~(PAGE_SIZE - 1);
+    if (Pages.empty())
+    {
+      FirstPageAddr = firstPage;
+      StartAddr = start;
+      EndAddr = end;
+    }
+    else
+    {
+      if (firstPage < FirstPageAddr)
+      {
+        Pages.insert(Pages.begin(), (FirstPageAddr - firstPage) / PAGE_SIZE, PagePtr());
+        FirstPageAddr = firstPage;
+      }
+      StartAddr = std::min(StartAddr, start);
+      EndAddr = std::max(EndAddr, end);
+    }
+    Pages.resize((EndAddr - FirstPageAddr + PAGE_SIZE - 1) / PAGE_SIZE);
+  }
+
+  uint8_t* PagedMemoryRegion::GetWritablePage(std::size_t idx)
+  {
+    auto& page = Pages[idx];
+    if (!page)
+    {
+      page = std::make_shared<Page>();
+    }
+    else if (page.use_count() > 1)
+    {
+      //copy on write
+      page = std::make_shared<Page>(*page);
+    }
+    return page->data();
+  }
 }
@@ -12,6 +12,11 @@
 
 //common includes
 #include <types.h>
+//std includes
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
 
 namespace Module
 {
@@ -37,4 +42,61 @@ namespace Module
     uint_t Start = 0;
     Dump Data;
   };
+
+  //! @brief Memory region with pages shared between images till overwritten
+  class PagedMemoryRegion
+  {
+  public:
+    PagedMemoryRegion() = default;
+    PagedMemoryRegion(const PagedMemoryRegion&) = delete;
+    PagedMemoryRegion(PagedMemoryRegion&&) = default;
+    PagedMemoryRegion& operator = (const PagedMemoryRegion&) = delete;
+    PagedMemoryRegion& operator = (PagedMemoryRegion&&) = default;
+
+    //! @brief Same as MemoryRegion::Update, only touched pages are copied if shared
+    void Update(uint_t addr, const void* data, std::size_t size);
+    //! @brief Apply another region on top of current one, fully overwritten pages are shared
+    void Update(const PagedMemoryRegion& rh);
+
+    uint_t Start() const
+    {
+      return StartAddr;
+    }
+
+    std::size_t Size() const
+    {
+      return EndAddr - StartAddr;
+    }
+
+    //! @brief Visit region content in chunks of at most PAGE_SIZE bytes
+    //! @param visitor callable with signature void(uint_t addr, const uint8_t* data, std::size_t size)
+    template<class VisitorType>
+    void ForEachChunk(const VisitorType& visitor) const
+    {
+      for (auto addr = StartAddr; addr < EndAddr; )
+      {
+        const auto pageIdx = (addr - FirstPageAddr) / PAGE_SIZE;
+        const auto pageAddr = FirstPageAddr + pageIdx * PAGE_SIZE;
+        const auto end = std::min<uint_t>(pageAddr + PAGE_SIZE, EndAddr);
+        const auto& page = Pages[pageIdx];
+        visitor(addr, (page ? page->data() : ZeroPage().data()) + (addr - pageAddr), end - addr);
+        addr = end;
+      }
+    }
+  private:
+    static const uint_t PAGE_SIZE = 4096;
+    using Page = std::array<uint8_t, PAGE_SIZE>;
+    using PagePtr = std::shared_ptr<Page>;
+
+    static const Page& ZeroPage();
+
+    void Extend(uint_t start, uint_t end);
+    uint8_t* GetWritablePage(std::size_t idx);
+  private:
+    uint_t FirstPageAddr = 0;
+    uint_t StartAddr = 0;
+    uint_t EndAddr = 0;
+    //null pages are zero-filled
+    std::vector<PagePtr> Pages;
+  };
 }
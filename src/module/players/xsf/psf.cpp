@@ -13,6 +13,7 @@
 #include "psf_bios.h"
 #include "psf_exe.h"
 #include "psf_vfs.h"
+#include "library_cache.h"
 #include "xsf.h"
 #include "xsf_factory.h"
 //common includes
@@ -233,12 +234,10 @@ namespace PSF
       }
     }
 
-    std::vector<ChannelState> GetState() const override
+    void GetState(std::vector<ChannelState>& result) const override
     {
       //http://problemkaputt.de/psx-spx.htm#soundprocessingunitspu
       const uint_t SPU_VOICES_COUNT = 24;
-      std::vector<ChannelState> result;
-      result.reserve(SPU_VOICES_COUNT * Spus.size());
       const auto iop = ::psx_get_iop_state(Emu.get());
       const auto spu = ::iop_get_spu_state(iop);
       for (const auto& trait : Spus)
@@ -260,7 +259,6 @@ namespace PSF
           }
         }
       }
-      return result;
     }
   private:
     void SetupExe(const PsxExe& exe)
@@ -269,10 +267,10 @@ namespace PSF
       SetRegisters(exe.PC, exe.SP);
     }
     
-    void SetRAM(const MemoryRegion& mem)
+    void SetRAM(const PagedMemoryRegion& mem)
     {
       const auto iop = ::psx_get_iop_state(Emu.get());
-      ::iop_upload_to_ram(iop, mem.Start, mem.Data.data(), mem.Data.size());
+      mem.ForEachChunk([iop](uint_t addr, const uint8_t* data, std::size_t size) {::iop_upload_to_ram(iop, addr, data, size);});
     }
     
     void SetRegisters(uint32_t pc, uint32_t sp)
@@ -449,6 +447,17 @@ namespace PSF
       const auto unpackedSection = Binary::Compression::Zlib::CreateDeferredDecompressContainer(std::move(packedSection));
       PsxExe::Parse(*unpackedSection, *Exe);
     }
+
+    void AddLibraryExe(Binary::Data::Ptr packedSection)
+    {
+      Require(!Vfs);
+      if (!Exe)
+      {
+        Exe = MakeRWPtr<PsxExe>();
+      }
+      const auto image = XSF::LibraryCache<PsxExe>::Get(std::move(packedSection), &DecodeExe);
+      Exe->Superimpose(*image);
+    }
     
     void AddVfs(const Binary::Container& reservedSection)
     {
@@ -481,6 +490,14 @@ namespace PSF
       res->Meta = std::move(Meta);
       return res;
     }
+  private:
+    static std::shared_ptr<const PsxExe> DecodeExe(Binary::Data::Ptr packedSection)
+    {
+      const auto unpackedSection = Binary::Compression::Zlib::CreateDeferredDecompressContainer(std::move(packedSection));
+      auto result = std::make_shared<PsxExe>();
+      PsxExe::Parse(*unpackedSection, *result);
+      return result;
+    }
   private:
     PsxExe::RWPtr Exe;
     PsxVfs::RWPtr Vfs;
@@ -514,7 +531,7 @@ namespace PSF
       ModuleDataBuilder builder;
       if (file.PackedProgramSection)
       {
-        MergeExe(file, additionalFiles, builder);
+        MergeExe(file, additionalFiles, false, builder);
       }
       if (file.ReservedSection)
       {
@@ -538,20 +555,27 @@ namespace PSF
       - Start at N=2. Stop at the first tag name that doesn't exist.
     - (done)    
     */
-    static void MergeExe(const XSF::File& data, const std::map<String, XSF::File>& additionalFiles, ModuleDataBuilder& dst)
+    static void MergeExe(const XSF::File& data, const std::map<String, XSF::File>& additionalFiles, bool isLibrary, ModuleDataBuilder& dst)
     {
       auto it = data.Dependencies.begin();
       const auto lim = data.Dependencies.end();
       if (it != lim)
       {
-        MergeExe(additionalFiles.at(*it), additionalFiles, dst);
+        MergeExe(additionalFiles.at(*it), additionalFiles, true, dst);
+      }
+      if (isLibrary)
+      {
+        dst.AddLibraryExe(data.PackedProgramSection);
+      }
+      else
+      {
+        dst.AddExe(data.PackedProgramSection);
       }
-      dst.AddExe(data.PackedProgramSection);
       if (it != lim)
       {
         for (++it; it != lim; ++it)
         {
-          MergeExe(additionalFiles.at(*it), additionalFiles, dst);
+          MergeExe(additionalFiles.at(*it), additionalFiles, true, dst);
         }
       }
     }
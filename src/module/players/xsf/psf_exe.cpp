@@ -69,5 +69,22 @@ namespace Module
       ExeParser parser(exe);
       Formats::Chiptune::PlaystationSoundFormat::ParsePSXExe(data, parser);
     }
+
+    void PsxExe::Superimpose(const PsxExe& rh)
+    {
+      if (!PC)
+      {
+        PC = rh.PC;
+      }
+      if (!SP)
+      {
+        SP = rh.SP;
+      }
+      if (!RefreshRate)
+      {
+        RefreshRate = rh.RefreshRate;
+      }
+      RAM.Update(rh.RAM);
+    }
   }
 }
@@ -36,9 +36,12 @@ namespace Module
       uint_t RefreshRate = 0;
       uint32_t PC = 0;
       uint32_t SP = 0;
-      MemoryRegion RAM;
+      PagedMemoryRegion RAM;
       
       static void Parse(const Binary::Container& data, PsxExe& exe);
+
+      //! @brief Apply another image on top of current one using the same rules as Parse does
+      void Superimpose(const PsxExe& rh);
     };
   }
 }
@@ -0,0 +1,67 @@
+/**
+*
+* @file
+*
+* @brief  Published analyzer implementation
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+//common includes
+#include <make_ptr.h>
+//library includes
+#include <module/analyzer.h>
+//std includes
+#include <array>
+#include <atomic>
+
+namespace Module
+{
+  class TripleBufferAnalyzer : public PublishedAnalyzer
+  {
+  public:
+    explicit TripleBufferAnalyzer(Analyzer::Ptr source)
+      : Source(std::move(source))
+      , Back(0)
+      , Middle(1)
+      , Front(2)
+    {
+    }
+
+    void Publish() override
+    {
+      auto& snapshot = Buffers[Back];
+      snapshot.clear();
+      Source->GetState(snapshot);
+      Back = Middle.exchange(Back | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    void GetState(std::vector<ChannelState>& result) const override
+    {
+      if (Middle.load(std::memory_order_relaxed) & FRESH)
+      {
+        Front = Middle.exchange(Front, std::memory_order_acq_rel) & INDEX_MASK;
+      }
+      const auto& snapshot = Buffers[Front];
+      result.insert(result.end(), snapshot.begin(), snapshot.end());
+    }
+  private:
+    static const uint_t INDEX_MASK = 3;
+    static const uint_t FRESH = 4;
+
+    const Analyzer::Ptr Source;
+    std::array<std::vector<ChannelState>, 3> Buffers;
+    //owned by producer
+    uint_t Back;
+    //exchanged between producer and consumer
+    mutable std::atomic<uint_t> Middle;
+    //owned by consumer
+    mutable uint_t Front;
+  };
+
+  PublishedAnalyzer::Ptr CreatePublishedAnalyzer(Analyzer::Ptr source)
+  {
+    return MakePtr<TripleBufferAnalyzer>(std::move(source));
+  }
+}
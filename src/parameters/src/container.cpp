@@ -12,20 +12,183 @@
 #include <make_ptr.h>
 //library includes
 #include <parameters/container.h>
+#include <parameters/visitor.h>
 //std includes
-#include <map>
+#include <algorithm>
 #include <utility>
+#include <vector>
+//boost includes
+#include <boost/variant/get.hpp>
+#include <boost/variant/static_visitor.hpp>
+#include <boost/variant/variant.hpp>
 
 namespace Parameters
 {
-  template<class T>
-  bool FindByName(const std::map<NameType, T>& map, const NameType& name, T& res)
+  //Values are kept in vector sorted by name hash, so lookup is a binary search over
+  //precalculated hashes with a single full path comparison in most cases.
+  //Visiting order is maintained on modifications, so const access is safe for concurrent readers
+  class FlatStorage
   {
-    const typename std::map<NameType, T>::const_iterator it = map.find(name);
-    return it != map.end()
-      ? (res = it->second, true)
-      : false;
-  }
+  public:
+    typedef boost::variant<IntType, StringType, DataType> ValueType;
+
+    template<class T>
+    bool Find(const NameType& name, T& res) const
+    {
+      const auto it = LowerBound(name);
+      if (it != Values.end() && it->first == name)
+      {
+        if (const auto val = boost::get<T>(&it->second))
+        {
+          res = *val;
+          return true;
+        }
+      }
+      return false;
+    }
+
+    template<class T>
+    bool Set(const NameType& name, const T& val)
+    {
+      const auto it = LowerBound(name);
+      const std::size_t idx = it - Values.begin();
+      if (it == Values.end() || it->first != name)
+      {
+        Values.emplace(it, name, val);
+        for (auto& ordered : Order)
+        {
+          if (ordered >= idx)
+          {
+            ++ordered;
+          }
+        }
+        AddToOrder(idx);
+        return true;
+      }
+      else if (IsChanged(it->second, val))
+      {
+        const bool typeChanged = !boost::get<T>(&it->second);
+        if (typeChanged)
+        {
+          RemoveFromOrder(idx);
+        }
+        it->second = val;
+        if (typeChanged)
+        {
+          AddToOrder(idx);
+        }
+        return true;
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    bool Remove(const NameType& name)
+    {
+      const auto it = LowerBound(name);
+      if (it != Values.end() && it->first == name)
+      {
+        const std::size_t idx = it - Values.begin();
+        RemoveFromOrder(idx);
+        Values.erase(it);
+        for (auto& ordered : Order)
+        {
+          if (ordered > idx)
+          {
+            --ordered;
+          }
+        }
+        return true;
+      }
+      return false;
+    }
+
+    void Process(Visitor& visitor) const
+    {
+      for (const auto idx : Order)
+      {
+        const auto& entry = Values[idx];
+        VisitorAdapter adapter(entry.first, visitor);
+        boost::apply_visitor(adapter, entry.second);
+      }
+    }
+  private:
+    typedef std::pair<NameType, ValueType> EntryType;
+    typedef std::vector<EntryType> EntriesType;
+
+    class VisitorAdapter : public boost::static_visitor<>
+    {
+    public:
+      VisitorAdapter(const NameType& name, Visitor& delegate)
+        : Name(name)
+        , Delegate(delegate)
+      {
+      }
+
+      template<class T>
+      void operator () (const T& val) const
+      {
+        Delegate.SetValue(Name, val);
+      }
+    private:
+      const NameType& Name;
+      Visitor& Delegate;
+    };
+
+    //visit by types in order of names as it was before
+    static bool IsVisitedBefore(const EntryType& lh, const EntryType& rh)
+    {
+      const auto lhType = lh.second.which();
+      const auto rhType = rh.second.which();
+      return lhType == rhType ? lh.first < rh.first : lhType < rhType;
+    }
+
+    void AddToOrder(std::size_t idx)
+    {
+      const auto pos = std::lower_bound(Order.begin(), Order.end(), Values[idx],
+        [this](std::size_t lh, const EntryType& rh) {return IsVisitedBefore(Values[lh], rh);});
+      Order.insert(pos, idx);
+    }
+
+    void RemoveFromOrder(std::size_t idx)
+    {
+      Order.erase(std::find(Order.begin(), Order.end(), idx));
+    }
+
+    EntriesType::iterator LowerBound(const NameType& name)
+    {
+      return std::lower_bound(Values.begin(), Values.end(), name, &Less);
+    }
+
+    EntriesType::const_iterator LowerBound(const NameType& name) const
+    {
+      return std::lower_bound(Values.begin(), Values.end(), name, &Less);
+    }
+
+    static bool Less(const EntryType& lh, const NameType& rh)
+    {
+      const auto lhHash = lh.first.Hash();
+      const auto rhHash = rh.Hash();
+      return lhHash == rhHash ? lh.first < rh : lhHash < rhHash;
+    }
+
+    template<class T>
+    static bool IsChanged(const ValueType& dst, const T& src)
+    {
+      const auto val = boost::get<T>(&dst);
+      return !val || *val != src;
+    }
+
+    static bool IsChanged(const ValueType& /*dst*/, const DataType& /*src*/)
+    {
+      return true;
+    }
+  private:
+    EntriesType Values;
+    std::vector<std::size_t> Order;
+  };
 
   class StorageContainer : public Container
   {
@@ -43,39 +206,28 @@ namespace Parameters
 
     bool FindValue(const NameType& name, IntType& val) const override
     {
-      return FindByName(Integers, name, val);
+      return Storage.Find(name, val);
     }
 
     bool FindValue(const NameType& name, StringType& val) const override
     {
-      return FindByName(Strings, name, val);
+      return Storage.Find(name, val);
     }
 
     bool FindValue(const NameType& name, DataType& val) const override
     {
-      return FindByName(Datas, name, val);
+      return Storage.Find(name, val);
     }
 
     void Process(Visitor& visitor) const override
     {
-      for (const auto& i : Integers)
-      {
-        visitor.SetValue(i.first, i.second);
-      }
-      for (const auto& s : Strings)
-      {
-        visitor.SetValue(s.first, s.second);
-      }
-      for (const auto& d : Datas)
-      {
-        visitor.SetValue(d.first, d.second);
-      }
+      Storage.Process(visitor);
     }
 
     //visitor virtuals
     void SetValue(const NameType& name, IntType val) override
     {
-      if (Set(Integers[name], val) | Strings.erase(name) | Datas.erase(name))
+      if (Storage.Set(name, val))
       {
         ++VersionValue;
       }
@@ -83,7 +235,7 @@ namespace Parameters
 
     void SetValue(const NameType& name, const StringType& val) override
     {
-      if (Integers.erase(name) | Set(Strings[name], val) | Datas.erase(name))
+      if (Storage.Set(name, val))
       {
         ++VersionValue;
       }
@@ -91,7 +243,7 @@ namespace Parameters
 
     void SetValue(const NameType& name, const DataType& val) override
     {
-      if (Integers.erase(name) | Strings.erase(name) | Set(Datas[name], val))
+      if (Storage.Set(name, val))
       {
         ++VersionValue;
       }
@@ -100,39 +252,14 @@ namespace Parameters
     //modifier virtuals
     void RemoveValue(const NameType& name) override
     {
-      if (Integers.erase(name) | Strings.erase(name) | Datas.erase(name))
+      if (Storage.Remove(name))
       {
         ++VersionValue;
       }
     }
-  private:
-    template<class Type>
-    static std::size_t Set(Type& dst, const Type& src)
-    {
-      if (dst != src)
-      {
-        dst = src;
-        return 1;
-      }
-      else
-      {
-        return 0;
-      }
-    }
-
-    static std::size_t Set(DataType& dst, const DataType& src)
-    {
-      dst = src;
-      return 1;
-    }
   private:
     uint_t VersionValue;
-    typedef std::map<NameType, IntType> IntegerMap;
-    typedef std::map<NameType, StringType> StringMap;
-    typedef std::map<NameType, DataType> DataMap;
-    IntegerMap Integers;
-    StringMap Strings;
-    DataMap Datas;
+    FlatStorage Storage;
   };
 
   class CompositeContainer : public Container
@@ -8,7 +8,9 @@
 *
 **/
 
+#include <parameters/container.h>
 #include <parameters/types.h>
+#include <parameters/visitor.h>
 
 #include <iostream>
 
@@ -27,6 +29,34 @@ namespace
       throw 1;
     }
   }
+
+  class DumpVisitor : public Parameters::Visitor
+  {
+  public:
+    void SetValue(const Parameters::NameType& name, Parameters::IntType val) override
+    {
+      Result += name.FullPath() + '=' + std::to_string(val) + ';';
+    }
+
+    void SetValue(const Parameters::NameType& name, const Parameters::StringType& val) override
+    {
+      Result += name.FullPath() + "='" + val + "';";
+    }
+
+    void SetValue(const Parameters::NameType& name, const Parameters::DataType& val) override
+    {
+      Result += name.FullPath() + "=#" + std::to_string(val.size()) + ';';
+    }
+
+    std::string Result;
+  };
+
+  std::string ToString(const Parameters::Accessor& params)
+  {
+    DumpVisitor visitor;
+    params.Process(visitor);
+    return visitor.Result;
+  }
 }
 
 int main()
@@ -104,6 +134,44 @@ int main()
     Test("three - three", (three - three).FullPath(), std::string());
     Test("three.Name", three.Name(), std::string("three"));
   }
+  std::cout << "---- Test for Parameters::Container" << std::endl;
+  {
+    using namespace Parameters;
+    const NameType one("one");
+    const NameType two("one.two");
+    const NameType three("one.two.three");
+    const Container::Ptr container = Container::Create();
+    IntType intVal = 0;
+    StringType strVal;
+    DataType dataVal;
+    Test("empty.Version", container->Version(), uint_t(0));
+    Test("empty.FindValue", container->FindValue(one, intVal), false);
+    container->SetValue(one, 1);
+    container->SetValue(three, "three");
+    container->SetValue(two, DataType(2));
+    Test("filled.Version", container->Version(), uint_t(3));
+    Test("filled.FindValue(one, int)", container->FindValue(one, intVal) && intVal == 1, true);
+    Test("filled.FindValue(one, str)", container->FindValue(one, strVal), false);
+    Test("filled.FindValue(three, str)", container->FindValue(three, strVal) && strVal == "three", true);
+    Test("filled.FindValue(two, data)", container->FindValue(two, dataVal) && dataVal.size() == 2, true);
+    Test("filled.Process", ToString(*container), std::string("one=1;one.two.three='three';one.two=#2;"));
+    container->SetValue(one, 1);
+    Test("same value.Version", container->Version(), uint_t(3));
+    container->SetValue(one, "1");
+    Test("changed type.Version", container->Version(), uint_t(4));
+    Test("changed type.FindValue(one, int)", container->FindValue(one, intVal), false);
+    Test("changed type.FindValue(one, str)", container->FindValue(one, strVal) && strVal == "1", true);
+    Test("changed type.Process", ToString(*container), std::string("one='1';one.two.three='three';one.two=#2;"));
+    container->SetValue(three, "3");
+    Test("changed value.Process", ToString(*container), std::string("one='1';one.two.three='3';one.two=#2;"));
+    container->RemoveValue(three);
+    container->RemoveValue(three);
+    Test("removed.Version", container->Version(), uint_t(6));
+    Test("removed.FindValue", container->FindValue(three, strVal), false);
+    Test("removed.Process", ToString(*container), std::string("one='1';one.two=#2;"));
+    container->SetValue(two, 2);
+    Test("retyped.Process", ToString(*container), std::string("one.two=2;one='1';"));
+  }
   }
   catch (int code)
   {
@@ -12,6 +12,8 @@
 
 //common includes
 #include <types.h>
+//std includes
+#include <functional>
 
 //! @brief Namespace is used to keep parameters-working related types and functions
 namespace Parameters
@@ -41,10 +43,14 @@ namespace Parameters
     //! @brief Delimiter between namespaces in parameters' names
     static const char NAMESPACE_DELIMITER = '.';
   public:
-    NameType() = default;
+    NameType()
+      : HashValue(Calculate(Path))
+    {
+    }
 
     /*explicit*/NameType(std::string path)
       : Path(std::move(path))
+      , HashValue(Calculate(Path))
     {
     }
 
@@ -55,12 +61,18 @@ namespace Parameters
 
     bool operator == (const NameType& rh) const
     {
-      return Path == rh.Path;
+      return HashValue == rh.HashValue && Path == rh.Path;
     }
 
     bool operator != (const NameType& rh) const
     {
-      return Path != rh.Path;
+      return !(*this == rh);
+    }
+
+    //! @brief Hash of full path calculated once at construction
+    std::size_t Hash() const
+    {
+      return HashValue;
     }
 
     bool IsEmpty() const
@@ -123,7 +135,13 @@ namespace Parameters
         ? Path.substr(lastDelim + 1)
         : Path;
     }
+  private:
+    static std::size_t Calculate(const std::string& path)
+    {
+      return std::hash<std::string>()(path);
+    }
   private:
     std::string Path;
+    std::size_t HashValue;
   };
 }
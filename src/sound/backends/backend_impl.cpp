@@ -17,7 +17,10 @@
 //library includes
 #include <async/worker.h>
 #include <debug/log.h>
+#include <debug/metrics.h>
 #include <l10n/api.h>
+#include <module/attributes.h>
+#include <module/fast_forward.h>
 #include <sound/render_params.h>
 #include <sound/silence.h>
 #include <sound/sound_parameters.h>
@@ -30,6 +33,8 @@ namespace
 {
   const Debug::Stream Dbg("Sound::Backend::Base");
   const L10n::TranslateFunctor translate = L10n::TranslateFunctor("sound_backends");
+  //labeled by module type since rendering cost is defined by player and emulated chips
+  const Debug::Metrics::HistogramFamily FrameRenderTime("zxtune_render_frame_duration_seconds", "module_type");
 }
 
 namespace Sound
@@ -105,10 +110,14 @@ namespace Sound
   class RendererWrapper : public Module::Renderer
   {
   public:
-    RendererWrapper(Module::Renderer::Ptr delegate, BackendCallback::Ptr callback)
+    RendererWrapper(Module::Renderer::Ptr delegate, BackendCallback::Ptr callback, Debug::Metrics::Histogram renderTime)
       : Delegate(std::move(delegate))
       , Callback(std::move(callback))
+      , RenderTime(renderTime)
       , State(Delegate->GetTrackState())
+      , Skipper(dynamic_cast<Module::FastForward*>(Delegate.get()))
+      , Analyzer(Module::CreatePublishedAnalyzer(Delegate->GetAnalyzer()))
+      , Publishing(false)
       , SeekRequest(NO_SEEK)
     {
     }
@@ -118,9 +127,11 @@ namespace Sound
       return State;
     }
 
+    //! Analyzer state is published on each frame after first request
     Module::Analyzer::Ptr GetAnalyzer() const override
     {
-      return Delegate->GetAnalyzer();
+      Publishing = true;
+      return Analyzer;
     }
 
     bool RenderFrame() override
@@ -128,10 +139,15 @@ namespace Sound
       const uint_t request = SeekRequest.exchange(NO_SEEK);
       if (request != NO_SEEK)
       {
-        Delegate->SetPosition(request);
+        Seek(request);
       }
       Callback->OnFrame(*State);
-      return Delegate->RenderFrame();
+      const bool hasMoreFrames = RenderFrameWithMetrics();
+      if (Publishing)
+      {
+        Analyzer->Publish();
+      }
+      return hasMoreFrames;
     }
 
     void Reset() override
@@ -144,11 +160,34 @@ namespace Sound
     {
       SeekRequest = frame;
     }
+  private:
+    void Seek(uint_t frame)
+    {
+      const uint_t curFrame = State->Frame();
+      if (Skipper && frame > curFrame)
+      {
+        Skipper->SkipFrames(frame - curFrame);
+      }
+      else
+      {
+        Delegate->SetPosition(frame);
+      }
+    }
+
+    bool RenderFrameWithMetrics()
+    {
+      const Debug::Metrics::Span span(RenderTime);
+      return Delegate->RenderFrame();
+    }
   private:
     static const uint_t NO_SEEK = ~uint_t(0);
     const Module::Renderer::Ptr Delegate;
     const BackendCallback::Ptr Callback;
+    const Debug::Metrics::Histogram RenderTime;
     const Module::TrackState::Ptr State;
+    Module::FastForward* const Skipper;
+    const Module::PublishedAnalyzer::Ptr Analyzer;
+    mutable std::atomic<bool> Publishing;
     std::atomic<uint_t> SeekRequest;
   };
 
@@ -290,6 +329,16 @@ namespace Sound
     return MakePtr<CallbackOverWorker>(cb, worker);
   }
 
+  Debug::Metrics::Histogram GetRenderTimeMetric(const Module::Holder& holder)
+  {
+    String type;
+    if (Debug::Metrics::IsEnabled())
+    {
+      holder.GetModuleProperties()->FindValue(Module::ATTR_TYPE, type);
+    }
+    return FrameRenderTime.Get(type);
+  }
+
   class ControlInternal : public PlaybackControl
   {
   public:
@@ -388,7 +437,7 @@ namespace Sound
     const auto pipeline = CreateSilenceDetector(params, target);
     const Module::Renderer::Ptr origRenderer = holder->CreateRenderer(params, pipeline);
     const BackendCallback::Ptr callback = CreateCallback(origCallback, worker);
-    const Module::Renderer::Ptr renderer = MakePtr<RendererWrapper>(origRenderer, callback);
+    const Module::Renderer::Ptr renderer = MakePtr<RendererWrapper>(origRenderer, callback, GetRenderTimeMetric(*holder));
     const Async::Worker::Ptr asyncWorker = MakePtr<AsyncWrapper>(callback, renderer);
     const Async::Job::Ptr job = Async::CreateJob(asyncWorker);
     return MakePtr<BackendInternal>(worker, renderer, job);
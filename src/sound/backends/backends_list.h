@@ -20,6 +20,7 @@ namespace Sound
   void RegisterMp3Backend(BackendsStorage& storage);
   void RegisterOggBackend(BackendsStorage& storage);
   void RegisterFlacBackend(BackendsStorage& storage);
+  void RegisterMultiBackend(BackendsStorage& storage);
   void RegisterDirectSoundBackend(BackendsStorage& storage);
   void RegisterWin32Backend(BackendsStorage& storage);
   void RegisterOssBackend(BackendsStorage& storage);
@@ -47,6 +48,7 @@ namespace Sound
     RegisterMp3Backend(storage);
     RegisterOggBackend(storage);
     RegisterFlacBackend(storage);
+    RegisterMultiBackend(storage);
   }
 
   inline void RegisterAllBackends(BackendsStorage& storage)
@@ -0,0 +1,224 @@
+/**
+*
+* @file
+*
+* @brief  Multi-format file backend implementation
+*
+* @author vitamin.caig@gmail.com
+*
+**/
+
+//local includes
+#include "backend_impl.h"
+#include "storage.h"
+//common includes
+#include <error_tools.h>
+#include <make_ptr.h>
+//library includes
+#include <debug/log.h>
+#include <l10n/api.h>
+#include <parameters/container.h>
+#include <parameters/merged_accessor.h>
+#include <sound/backend_attrs.h>
+#include <sound/backends_parameters.h>
+#include <strings/array.h>
+//std includes
+#include <algorithm>
+//boost includes
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/split.hpp>
+//text includes
+#include "text/backends.h"
+
+#define FILE_TAG 3B0E6A5D
+
+namespace
+{
+  const Debug::Stream Dbg("Sound::Backend::Multi");
+  const L10n::TranslateFunctor translate = L10n::TranslateFunctor("sound_backends");
+}
+
+namespace Sound
+{
+namespace Multi
+{
+  const String ID = Text::MULTI_BACKEND_ID;
+  const char* const DESCRIPTION = L10n::translate("Multi-format file backend");
+
+  const String FILE_BACKENDS[] =
+  {
+    Text::WAV_BACKEND_ID,
+    Text::MP3_BACKEND_ID,
+    Text::OGG_BACKEND_ID,
+    Text::FLAC_BACKEND_ID,
+  };
+
+  /*
+    Module is rendered once and the same chunks are passed to all the encoders.
+    Each encoder works in its own thread fed via bounded queue (see file backends buffers),
+    so slow encoders are executed concurrently and the rendering is blocked only when queue is full.
+  */
+  class BackendWorker : public Sound::BackendWorker
+  {
+  public:
+    explicit BackendWorker(std::vector<Sound::BackendWorker::Ptr> delegates)
+      : Delegates(std::move(delegates))
+    {
+    }
+
+    void Startup() override
+    {
+      for (const auto& delegate : Delegates)
+      {
+        delegate->Startup();
+      }
+    }
+
+    void Shutdown() override
+    {
+      for (const auto& delegate : Delegates)
+      {
+        delegate->Shutdown();
+      }
+    }
+
+    void Pause() override
+    {
+      for (const auto& delegate : Delegates)
+      {
+        delegate->Pause();
+      }
+    }
+
+    void Resume() override
+    {
+      for (const auto& delegate : Delegates)
+      {
+        delegate->Resume();
+      }
+    }
+
+    void FrameStart(const Module::TrackState& state) override
+    {
+      for (const auto& delegate : Delegates)
+      {
+        delegate->FrameStart(state);
+      }
+    }
+
+    void FrameFinish(Chunk buffer) override
+    {
+      for (auto it = Delegates.begin(), last = Delegates.end() - 1; it != last; ++it)
+      {
+        Chunk copy(buffer.size());
+        std::copy(buffer.begin(), buffer.end(), copy.begin());
+        (*it)->FrameFinish(std::move(copy));
+      }
+      Delegates.back()->FrameFinish(std::move(buffer));
+    }
+
+    VolumeControl::Ptr GetVolumeControl() const override
+    {
+      // Does not support volume control
+      return VolumeControl::Ptr();
+    }
+  private:
+    const std::vector<Sound::BackendWorker::Ptr> Delegates;
+  };
+
+  class BackendParameters
+  {
+  public:
+    explicit BackendParameters(Parameters::Accessor::Ptr params)
+      : Params(std::move(params))
+    {
+    }
+
+    Strings::Array GetBackends() const
+    {
+      Parameters::StringType ids;
+      Params->FindValue(Parameters::ZXTune::Sound::Backends::Multi::BACKENDS, ids);
+      Strings::Array splitted;
+      boost::algorithm::split(splitted, ids, !boost::algorithm::is_alnum(), boost::algorithm::token_compress_on);
+      Strings::Array result;
+      for (const auto& id : splitted)
+      {
+        if (id.empty() || result.end() != std::find(result.begin(), result.end(), id))
+        {
+          continue;
+        }
+        if (std::end(FILE_BACKENDS) == std::find(std::begin(FILE_BACKENDS), std::end(FILE_BACKENDS), id))
+        {
+          throw MakeFormattedError(THIS_LINE, translate("Backend '%1%' is not a file-based one."), id);
+        }
+        result.push_back(id);
+      }
+      if (result.empty())
+      {
+        throw Error(THIS_LINE, translate("Backends for multi-format output are not specified."));
+      }
+      return result;
+    }
+
+    //! Parameters for delegates with multi backend specific file options applied to all of them
+    Parameters::Accessor::Ptr GetDelegatesParameters() const
+    {
+      namespace Backends = Parameters::ZXTune::Sound::Backends;
+      const Parameters::Container::Ptr overrides = Parameters::Container::Create();
+      Parameters::StringType filename;
+      if (Params->FindValue(Backends::Multi::PREFIX + Backends::File::FILENAME.Name(), filename))
+      {
+        overrides->SetValue(Backends::File::FILENAME, filename);
+      }
+      Parameters::IntType buffers = Backends::Multi::BUFFERS_DEFAULT;
+      if (Params->FindValue(Backends::Multi::PREFIX + Backends::File::BUFFERS.Name(), buffers)
+       || !Params->FindValue(Backends::File::BUFFERS, buffers))
+      {
+        overrides->SetValue(Backends::File::BUFFERS, buffers);
+      }
+      return Parameters::CreateMergedAccessor(overrides, Params);
+    }
+  private:
+    const Parameters::Accessor::Ptr Params;
+  };
+
+  class BackendWorkerFactory : public Sound::BackendWorkerFactory
+  {
+  public:
+    explicit BackendWorkerFactory(const BackendsStorage& storage)
+      : Storage(storage)
+    {
+    }
+
+    BackendWorker::Ptr CreateWorker(Parameters::Accessor::Ptr params, Module::Holder::Ptr holder) const override
+    {
+      const BackendParameters backendParams(params);
+      const Parameters::Accessor::Ptr delegateParams = backendParams.GetDelegatesParameters();
+      std::vector<Sound::BackendWorker::Ptr> delegates;
+      for (const auto& id : backendParams.GetBackends())
+      {
+        const Sound::BackendWorkerFactory::Ptr factory = Storage.FindFactory(id);
+        if (!factory)
+        {
+          throw MakeFormattedError(THIS_LINE, translate("Backend '%1%' is not available."), id);
+        }
+        Dbg("Add %1% encoder", id);
+        delegates.push_back(factory->CreateWorker(delegateParams, holder));
+      }
+      return MakePtr<BackendWorker>(std::move(delegates));
+    }
+  private:
+    //factory is owned by storage
+    const BackendsStorage& Storage;
+  };
+}//Multi
+}//Sound
+
+namespace Sound
+{
+  void RegisterMultiBackend(BackendsStorage& storage)
+  {
+    const BackendWorkerFactory::Ptr factory = MakePtr<Multi::BackendWorkerFactory>(storage);
+    storage.Register(Multi::ID, Multi::DESCRIPTION, CAP_TYPE_FILE, factory);
+  }
+}
@@ -169,7 +169,7 @@ namespace Sound
       return ids;
     }
 
-    BackendWorkerFactory::Ptr FindFactory(const String& id) const
+    BackendWorkerFactory::Ptr FindFactory(const String& id) const override
     {
       const std::vector<FactoryWithId>::const_iterator it = std::find(Factories.begin(), Factories.end(), id);
       return it != Factories.end()
@@ -26,5 +26,7 @@ namespace Sound
     virtual void Register(const String& id, const char* description, uint_t caps, const Error& status) = 0;
     //Disabled due to configuration
     virtual void Register(const String& id, const char* description, uint_t caps) = 0;
+    //Functional backend lookup, empty pointer if not found
+    virtual BackendWorkerFactory::Ptr FindFactory(const String& id) const = 0;
   };
 }
@@ -25,6 +25,9 @@ extern const Char FLAC_BACKEND_ID[] = {
 extern const Char MP3_BACKEND_ID[] = {
   'm','p','3',0
 };
+extern const Char MULTI_BACKEND_ID[] = {
+  'm','u','l','t','i',0
+};
 extern const Char NULL_BACKEND_ID[] = {
   'n','u','l','l',0
 };
@@ -10,6 +10,7 @@ extern const Char DSOUND_BACKEND_ID[];
 extern const Char FILE_BACKEND_DEFAULT_COMMENT[];
 extern const Char FLAC_BACKEND_ID[];
 extern const Char MP3_BACKEND_ID[];
+extern const Char MULTI_BACKEND_ID[];
 extern const Char NULL_BACKEND_ID[];
 extern const Char OGG_BACKEND_AUTHOR_TAG[];
 extern const Char OGG_BACKEND_COMMENT_TAG[];
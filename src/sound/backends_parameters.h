@@ -47,6 +47,25 @@ namespace Parameters
           //@}
         }
 
+        //! @brief Multi-format file backend parameters namespace
+        namespace Multi
+        {
+          //! @brief Parameters#ZXTune#Sound#Backends#Multi namespace prefix
+          extern const NameType PREFIX;
+
+          //@{
+          //! @name Multi-format file backend parameters
+
+          //! @brief Delimited identifiers of file backends to encode same sound data by
+          //! @note Backend-specific options are used for each encoder. Filename template and buffers count specified
+          //! for multi backend override common file-based ones.
+          extern const NameType BACKENDS;
+
+          //! Default buffers count for each encoder
+          const IntType BUFFERS_DEFAULT = 16;
+          //@}
+        }
+
         //! @brief %Win32 backend parameters namespace
         namespace Win32
         {
@@ -38,6 +38,15 @@ namespace Sound
       *Pos++ = smp;
     }
 
+    //! @brief Continue filling of already existing data, capacity is reused if possible
+    void Append(Chunk content, std::size_t maxSize)
+    {
+      const std::size_t prevSize = content.size();
+      Content = std::move(content);
+      Content.resize(prevSize + maxSize);
+      Pos = Content.data() + prevSize;
+    }
+
     Sample* Allocate(std::size_t size)
     {
       Sample* res = Pos;
@@ -14,6 +14,8 @@
 #include <math/numeric.h>
 #include <math/fixedpoint.h>
 #include <sound/gainer.h>
+//std includes
+#include <algorithm>
 //boost includes
 #include <boost/integer/static_log2.hpp>
 
@@ -25,32 +27,73 @@ namespace Sound
   static_assert(USED_GAIN_BITS < AVAIL_GAIN_BITS, "Not enough bits");
   const Gain::Type MAX_LEVEL(1 << (AVAIL_GAIN_BITS - USED_GAIN_BITS));
 
+  /*
+    Gain is applied in a single pass over the chunk with level kept as plain integer,
+    so the loop has no dependencies between samples. Changed gain (e.g. fading or volume
+    change) is linearly ramped over the chunk from previous level to avoid clicks.
+  */
   class GainCore
   {
   public:
     GainCore()
       : Level()
+      , Initialized()
     {
     }
 
-    Sample Apply(Sample in) const
+    void Apply(Gain::Type in, Sample* it, const Sample* lim)
     {
-      return Sample(Clamp((Level * in.Left()).Round()), Clamp((Level * in.Right()).Round()));
+      static const Gain::Type IDENTITY(1);
+      const Gain::Type target = std::min(in, MAX_LEVEL);
+      if (!Initialized || target == Level)
+      {
+        if (target != IDENTITY)
+        {
+          ApplyConstant(target.Raw(), it, lim);
+        }
+      }
+      else
+      {
+        ApplyRamp(Level.Raw(), target.Raw(), it, lim);
+      }
+      Level = target;
+      Initialized = true;
     }
+  private:
+    typedef Gain::Type::ValueType LevelType;
 
-    void SetGain(Gain::Type in)
+    static void ApplyConstant(LevelType level, Sample* it, const Sample* lim)
     {
-      Level = std::min(in, MAX_LEVEL);
+      for (; it != lim; ++it)
+      {
+        *it = Apply(level, *it);
+      }
     }
-    
-  private:
-    static Sample::Type Clamp(Gain::Type::ValueType in)
+
+    static void ApplyRamp(LevelType from, LevelType to, Sample* it, const Sample* lim)
+    {
+      const int64_t delta = to - from;
+      const int64_t count = lim - it;
+      for (int64_t idx = 1; it != lim; ++it, ++idx)
+      {
+        *it = Apply(static_cast<LevelType>(from + delta * idx / count), *it);
+      }
+    }
+
+    static Sample Apply(LevelType level, Sample in)
     {
-      return Math::Clamp<Gain::Type::ValueType>(in, Sample::MIN, Sample::MAX);
+      return Sample(Scale(level, in.Left()), Scale(level, in.Right()));
     }
 
+    //same as Gain::Type arithmetic with rounding
+    static Sample::Type Scale(LevelType level, Sample::WideType in)
+    {
+      const LevelType val = (level * in + Gain::Type::PRECISION / 2) / Gain::Type::PRECISION;
+      return Math::Clamp<LevelType>(val, Sample::MIN, Sample::MAX);
+    }
   private:
     Gain::Type Level;
+    bool Initialized;
   };
 
   class FixedPointGainer : public Receiver
@@ -65,15 +108,9 @@ namespace Sound
 
     void ApplyData(Chunk in) override
     {
-      static const Gain::Type IDENTITY(1);
-      const auto gain = Gain->Get();
-      if (gain != IDENTITY)
+      if (!in.empty())
       {
-        Core.SetGain(Gain->Get());
-        for (auto& val : in)
-        {
-          val = Core.Apply(val);
-        }
+        Core.Apply(Gain->Get(), in.begin(), in.end());
       }
       return Delegate->ApplyData(std::move(in));
     }
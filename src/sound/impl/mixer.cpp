@@ -44,6 +44,14 @@ namespace Sound
       return Core.Mix(in);
     }
 
+    void ApplyData(const typename Base::InDataType* in, std::size_t count, Sample* out) const override
+    {
+      for (const auto* const lim = in + count; in != lim; ++in, ++out)
+      {
+        *out = Core.Mix(*in);
+      }
+    }
+
     void SetMatrix(const typename Base::Matrix& data) override
     {
       const auto it = std::find_if(data.begin(), data.end(), std::not1(std::mem_fun_ref(&Gain::IsNormalized)));
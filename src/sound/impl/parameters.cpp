@@ -103,6 +103,13 @@ namespace Parameters
 					extern const NameType BUFFERS = PREFIX + "buffers";
         }
 
+        namespace Multi
+        {
+          extern const NameType PREFIX = Backends::PREFIX + "multi";
+
+          extern const NameType BACKENDS = PREFIX + "backends";
+        }
+
         namespace Win32
         {
           extern const NameType PREFIX = Backends::PREFIX + "win32";
@@ -15,6 +15,8 @@
 #include <math/numeric.h>
 #include <sound/sample.h>
 //std includes
+#include <algorithm>
+#include <array>
 #include <cmath>
 
 namespace Sound
@@ -30,7 +32,8 @@ namespace Sound
     {
     }
 
-    void SetParameters(uint64_t sampleFreq, uint64_t cutOffFreq)
+    //! @param q quality factor of the section, 1.0 gives slight resonance near cutoff
+    void SetParameters(uint64_t sampleFreq, uint64_t cutOffFreq, float q = 1.0f)
     {
       /*
         A0 * Y[i] = B0 * X[i] + B1 * X[i-1] + B2 * X[i-2] - A1 * Y[i-1] - A2 * Y[i-2]
@@ -61,7 +64,6 @@ namespace Sound
           http://www.ece.uah.edu/~jovanov/CPE621/notes/msp430_filter.pdf
       */
       const float w0 = 3.14159265358f * 2.0f * cutOffFreq / sampleFreq;
-      const float q = 1.0f;
       //specify gain to avoid overload
       const float gain = 1.0f;//0.98f;
 
@@ -92,31 +94,128 @@ namespace Sound
 
     void Feed(const Sample in)
     {
-      const int_t inLeftSum = int_t(in.Left()) + 2 * In1.Left() + In2.Left();
-      Coeff sumLeft = A * inLeftSum >> DCShift;
-      sumLeft += B * Out1.Left();
-      sumLeft -= C * Out2.Left();
-
-      const int_t inRightSum = int_t(in.Right()) + 2 * In1.Right() + In2.Right();
-      Coeff sumRight = A * inRightSum >> DCShift;
-      sumRight += B * Out1.Right();
-      sumRight -= C * Out2.Right();
-
+      const Sample out = Calculate(in, In1, In2, Out1, Out2);
       Out2 = Out1;
-      Out1 = Sample(sumLeft.Integer(), sumRight.Integer());
+      Out1 = out;
       In2 = In1;
       In1 = in;
     }
 
+    //! @brief Process block of samples, same as sequential Feed calls
+    //! @note History is kept unpacked in locals, so both channels are calculated independently without memory roundtrips
+    void Feed(const Sample* in, std::size_t count)
+    {
+      FeedBlock(in, count, [](Sample) {});
+    }
+
+    //! @brief Process block of samples storing each output sample
+    void Feed(const Sample* in, std::size_t count, Sample* out)
+    {
+      FeedBlock(in, count, [&out](Sample res) {*out++ = res;});
+    }
+
     Sample Get() const
     {
       return Out1;
     }
   private:
     typedef Math::FixedPoint<int_t, 16384> Coeff;
+
+    template<class OutputFunc>
+    void FeedBlock(const Sample* in, std::size_t count, OutputFunc output)
+    {
+      Channel left(In1.Left(), In2.Left(), Out1.Left(), Out2.Left());
+      Channel right(In1.Right(), In2.Right(), Out1.Right(), Out2.Right());
+      for (const Sample* const lim = in + count; in != lim; ++in)
+      {
+        left.Feed(in->Left(), Calculate(in->Left(), left));
+        right.Feed(in->Right(), Calculate(in->Right(), right));
+        output(Sample(left.Out1, right.Out1));
+      }
+      In1 = Sample(left.In1, right.In1);
+      In2 = Sample(left.In2, right.In2);
+      Out1 = Sample(left.Out1, right.Out1);
+      Out2 = Sample(left.Out2, right.Out2);
+    }
+
+    struct Channel
+    {
+      Channel(int_t in1, int_t in2, int_t out1, int_t out2)
+        : In1(in1), In2(in2)
+        , Out1(out1), Out2(out2)
+      {
+      }
+
+      void Feed(int_t in, int_t out)
+      {
+        Out2 = Out1;
+        //same truncation as for packed history
+        Out1 = static_cast<Sample::Type>(out);
+        In2 = In1;
+        In1 = in;
+      }
+
+      int_t In1, In2;
+      int_t Out1, Out2;
+    };
+
+    Sample Calculate(Sample in, Sample in1, Sample in2, Sample out1, Sample out2) const
+    {
+      return Sample(Calculate(in.Left(), Channel(in1.Left(), in2.Left(), out1.Left(), out2.Left())),
+                    Calculate(in.Right(), Channel(in1.Right(), in2.Right(), out1.Right(), out2.Right())));
+    }
+
+    int_t Calculate(int_t in, const Channel& hist) const
+    {
+      Coeff sum = A * (in + 2 * hist.In1 + hist.In2) >> DCShift;
+      sum += B * hist.Out1;
+      sum -= C * hist.Out2;
+      return sum.Integer();
+    }
+
     Coeff A, B, C;
     uint_t DCShift;
     Sample In1, In2;
     Sample Out1, Out2;
   };
+
+  //! @brief 4th order Butterworth low-pass filter made of two cascaded LPFilter sections
+  //! @note Sharper rolloff and less resonance than single section at the cost of twice more calculations
+  class CascadedLPFilter
+  {
+  public:
+    void SetParameters(uint64_t sampleFreq, uint64_t cutOffFreq)
+    {
+      //1/(2cos(pi/8)) and 1/(2cos(3pi/8)), lower-Q section first to avoid overshoot of intermediate signal
+      First.SetParameters(sampleFreq, cutOffFreq, 0.5412f);
+      Second.SetParameters(sampleFreq, cutOffFreq, 1.3066f);
+    }
+
+    void Feed(const Sample in)
+    {
+      First.Feed(in);
+      Second.Feed(First.Get());
+    }
+
+    void Feed(const Sample* in, std::size_t count)
+    {
+      std::array<Sample, 64> intermediate;
+      while (count)
+      {
+        const std::size_t portion = std::min(count, intermediate.size());
+        First.Feed(in, portion, intermediate.data());
+        Second.Feed(intermediate.data(), portion);
+        in += portion;
+        count -= portion;
+      }
+    }
+
+    Sample Get() const
+    {
+      return Second.Get();
+    }
+  private:
+    LPFilter First;
+    LPFilter Second;
+  };
 }
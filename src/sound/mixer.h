@@ -24,6 +24,8 @@ namespace Sound
     virtual ~FixedChannelsMixer() = default;
 
     virtual Sample ApplyData(const InDataType& in) const = 0;
+    //! @brief Mix block of samples
+    virtual void ApplyData(const InDataType* in, std::size_t count, Sample* out) const = 0;
   };
 
   typedef FixedChannelsMixer<1> OneChannelMixer;
@@ -15,6 +15,7 @@
 #include <boost/range/size.hpp>
 #include <iostream>
 #include <iomanip>
+#include <vector>
 
 #define FILE_TAG B5BAF4C1
 
@@ -121,16 +122,23 @@ namespace Sound
     
     void ApplyData(Chunk data) override
     {
-      if (Check(data.front().Left(), ToCompare.Left()) && Check(data.front().Right(), ToCompare.Right()))
+      if (data.size() != ToCompare.size())
       {
-        std::cout << "passed\n";
+        std::cout << "failed\n";
+        throw MakeFormattedError(THIS_LINE, "Failed. Size=%1% while expected=%2%", data.size(), ToCompare.size());
       }
-      else
+      for (std::size_t idx = 0; idx != data.size(); ++idx)
       {
-        std::cout << "failed\n";
-        throw MakeFormattedError(THIS_LINE, "Failed. Value=<%1%,%2%> while expected=<%3%,%4%>",
-          data.front().Left(), data.front().Right(), ToCompare.Left(), ToCompare.Right());
+        const Sample val = data[idx];
+        const Sample ref = ToCompare[idx];
+        if (!Check(val.Left(), ref.Left()) || !Check(val.Right(), ref.Right()))
+        {
+          std::cout << "failed\n";
+          throw MakeFormattedError(THIS_LINE, "Failed. Value=<%1%,%2%> while expected=<%3%,%4%> at %5%",
+            val.Left(), val.Right(), ref.Left(), ref.Right(), idx);
+        }
       }
+      std::cout << "passed\n";
     }
     
     void Flush() override
@@ -139,7 +147,16 @@ namespace Sound
     
     void SetData(const Sample::Type& tc)
     {
-      ToCompare = Sample(tc, tc);
+      ToCompare.assign(1, Sample(tc, tc));
+    }
+
+    void SetData(std::initializer_list<Sample::Type> tcs)
+    {
+      ToCompare.clear();
+      for (const auto tc : tcs)
+      {
+        ToCompare.push_back(Sample(tc, tc));
+      }
     }
   private:
     static bool Check(Sample::Type data, Sample::Type ref)
@@ -147,7 +164,7 @@ namespace Sound
       return Math::Absolute(int_t(data) - ref) <= THRESHOLD;
     }
   private:
-    Sample ToCompare;
+    std::vector<Sample> ToCompare;
   };
   
   class Source : public GainSource
@@ -193,6 +210,26 @@ int main()
         gainer->ApplyData(builder.CaptureResult());
       }
     }
+    {
+      std::cout << "--- Test for gain change ---\n";
+      src->SetGain(Gain::Type(1));
+      ChunkBuilder builder;
+      builder.Reserve(1);
+      builder.Add(Sample(Sample::MAX, Sample::MAX));
+      std::cout << "Checking for full gain: ";
+      tgt->SetData(Sample::MAX);
+      gainer->ApplyData(builder.CaptureResult());
+      //changed gain is ramped over the whole chunk
+      src->SetGain(Gain::Type(0));
+      builder.Reserve(4);
+      for (uint_t idx = 0; idx != 4; ++idx)
+      {
+        builder.Add(Sample(Sample::MAX, Sample::MAX));
+      }
+      std::cout << "Checking for ramp to empty gain: ";
+      tgt->SetData({ScaledMax(3, 4), ScaledMax(1, 2), ScaledMax(1, 4), Sample::MID});
+      gainer->ApplyData(builder.CaptureResult());
+    }
     std::cout << " Succeed!" << std::endl;
   }
   catch (const Error& e)
@@ -17,8 +17,9 @@
 #include <math/bitops.h>
 #include <strings/encoding.h>
 //std includes
-#include <algorithm>
+#include <array>
 #include <cassert>
+#include <limits>
 
 namespace Strings
 {
@@ -665,111 +666,141 @@ namespace Strings
     }
   };
   
-  uint_t GetPenalty(const std::vector<uint32_t>& symbols)
+  class PenaltyCalculator
   {
-    enum
+  public:
+    PenaltyCalculator()
+      : Categories()
+      , Pairs()
+      , LanguagesStrong(~0)
+      , LanguagesWeak(0)
+      , Prev(CharTraits::Undefined)
+      , Untranslatable(false)
+    {
+    }
+
+    void Add(uint8_t curr, uint_t langs)
     {
-      PrevIsVowel = 1,
-      CurrIsVowel = 2,
-    
-      ConsCons = 0,
-      VowCons = PrevIsVowel,
-      ConsVow = CurrIsVowel,
-      VowVow = PrevIsVowel + CurrIsVowel,
-      
-      PairsTypes,
-    };
-    uint_t categories[CharTraits::CategoriesCount] = {0};
-    uint_t pairs[PairsTypes] = {0};//2*curIsVowel + 1*prevIsVowel;
-    uint_t languagesStrong = ~0;
-    uint_t languagesWeak = 0;
-    uint8_t prev = CharTraits::Undefined;
-    const auto& unicode = UnicodeTraits::Instance();
-    for (const auto sym : symbols)
-    {
-      const auto curr = unicode.GetTraits(sym);
       if (!curr)
       {
-        return std::numeric_limits<uint_t>::max();//don't known how to recode
+        Untranslatable = true;
+        return;
       }
       const auto cat = CharTraits::GetCategory(curr);
-      ++categories[cat];
+      ++Categories[cat];
       const bool isAlphabetic = CharTraits::IsAlphabetic(curr);
-      if (CharTraits::IsAlphabetic(prev) && isAlphabetic)
+      if (CharTraits::IsAlphabetic(Prev) && isAlphabetic)
       {
-        const bool prevIsVowel = prev & CharTraits::Vowel;
+        const bool prevIsVowel = Prev & CharTraits::Vowel;
         const bool currIsVowel = curr & CharTraits::Vowel;
-        ++pairs[CurrIsVowel * currIsVowel + PrevIsVowel * prevIsVowel];
+        ++Pairs[CurrIsVowel * currIsVowel + PrevIsVowel * prevIsVowel];
       }
       if (isAlphabetic)
       {
-        const auto langs = unicode.GetLanguages(sym);
-        languagesStrong &= langs;
-        languagesWeak |= langs;
+        LanguagesStrong &= langs;
+        LanguagesWeak |= langs;
       }
-      prev = curr;
-    }
-    const auto strongLangsCount = Math::CountBits(languagesStrong);
-    const auto weakLangsCount = Math::CountBits(languagesWeak);
-    const auto strongLangsPenalty = strongLangsCount > 1
-      ? strongLangsCount * 8
-      : (strongLangsCount == 1 ? 0 : 1024);
-    const auto weakLangsPenalty = weakLangsCount > 1
-      ? weakLangsCount * 4
-      : (weakLangsCount == 1 ? 0 : 2);
-    const auto ctrlPenalty = categories[CharTraits::Control] * 512;
-    const auto graphPenalty = categories[CharTraits::Graphic] * 256;
-    const auto punctPenalty = categories[CharTraits::Punctuation] * 128;
-    const auto pairsPenalty = (pairs[ConsCons] + pairs[VowVow]) * 64;
-    return ctrlPenalty
-      + graphPenalty
-      + punctPenalty
-      + pairsPenalty
-      + strongLangsPenalty + weakLangsPenalty
-    ;
-  }
+      Prev = curr;
+    }
 
-  class Codepage
-  {
-  public:
-    virtual ~Codepage() = default;
+    void Add(uint32_t sym)
+    {
+      const auto& unicode = UnicodeTraits::Instance();
+      Add(unicode.GetTraits(sym), unicode.GetLanguages(sym));
+    }
+
+    uint_t GetResult() const
+    {
+      if (Untranslatable)
+      {
+        return std::numeric_limits<uint_t>::max();//don't known how to recode
+      }
+      const auto strongLangsCount = Math::CountBits(LanguagesStrong);
+      const auto weakLangsCount = Math::CountBits(LanguagesWeak);
+      const auto strongLangsPenalty = strongLangsCount > 1
+        ? strongLangsCount * 8
+        : (strongLangsCount == 1 ? 0 : 1024);
+      const auto weakLangsPenalty = weakLangsCount > 1
+        ? weakLangsCount * 4
+        : (weakLangsCount == 1 ? 0 : 2);
+      const auto ctrlPenalty = Categories[CharTraits::Control] * 512;
+      const auto graphPenalty = Categories[CharTraits::Graphic] * 256;
+      const auto punctPenalty = Categories[CharTraits::Punctuation] * 128;
+      const auto pairsPenalty = (Pairs[ConsCons] + Pairs[VowVow]) * 64;
+      return ctrlPenalty
+        + graphPenalty
+        + punctPenalty
+        + pairsPenalty
+        + strongLangsPenalty + weakLangsPenalty
+      ;
+    }
+  private:
+    enum
+    {
+      PrevIsVowel = 1,
+      CurrIsVowel = 2,
     
-    virtual bool Check(StringView str) const = 0;
-    virtual std::vector<uint32_t> Translate(StringView str) const = 0;
+      ConsCons = 0,
+      VowCons = PrevIsVowel,
+      ConsVow = CurrIsVowel,
+      VowVow = PrevIsVowel + CurrIsVowel,
+      
+      PairsTypes,
+    };
+    uint_t Categories[CharTraits::CategoriesCount];
+    uint_t Pairs[PairsTypes];//2*curIsVowel + 1*prevIsVowel;
+    uint_t LanguagesStrong;
+    uint_t LanguagesWeak;
+    uint8_t Prev;
+    bool Untranslatable;
   };
-  
-  template<class Traits>
-  class Codepage8Bit : public Codepage
+
+  //Unicode traits of each byte are precalculated, so scoring does not require translation
+  class Codepage8Bit
   {
   public:
-    bool Check(StringView) const override
+    typedef uint32_t (*GetUnicodeFunc)(uint8_t);
+    
+    explicit Codepage8Bit(GetUnicodeFunc getUnicode)
+      : GetUnicode(getUnicode)
     {
-      return true;
+      const auto& unicode = UnicodeTraits::Instance();
+      for (uint_t idx = 0; idx != Symbols.size(); ++idx)
+      {
+        const auto sym = GetUnicode(static_cast<uint8_t>(idx));
+        Symbols[idx].Traits = unicode.GetTraits(sym);
+        Symbols[idx].Languages = static_cast<uint16_t>(unicode.GetLanguages(sym));
+      }
     }
-  
-    std::vector<uint32_t> Translate(StringView str) const override
+    
+    void Score(uint8_t sym, PenaltyCalculator& penalty) const
     {
-      std::vector<uint32_t> result(str.size());
-      std::transform(str.begin(), str.end(), result.begin(), &Traits::GetUnicode);
-      return result;
+      const auto& traits = Symbols[sym];
+      penalty.Add(traits.Traits, traits.Languages);
     }
-      
-    static const Codepage& Instance()
+    
+    void Translate(StringView str, Utf8Builder& result) const
     {
-      static const Codepage8Bit<Traits> instance;
-      return instance;
+      for (const auto sym : str)
+      {
+        result.Add(GetUnicode(static_cast<uint8_t>(sym)));
+      }
     }
   private:
-    Codepage8Bit()
+    struct SymbolTraits
     {
-    }
+      uint8_t Traits;
+      uint16_t Languages;
+    };
+    const GetUnicodeFunc GetUnicode;
+    std::array<SymbolTraits, 256> Symbols;
   };
   
   //https://en.wikipedia.org/wiki/Shift_JIS
-  class ShiftJIS : public Codepage
+  class ShiftJIS
   {
   public:
-    bool Check(StringView str) const override
+    static bool Check(StringView str)
     {
       for (auto it = str.begin(); it != str.end(); ++it)
       {
@@ -803,46 +834,47 @@ namespace Strings
       return true;
     }
     
-    std::vector<uint32_t> Translate(StringView str) const override
+    static uint_t GetPenalty(StringView str)
+    {
+      PenaltyCalculator penalty;
+      ForEachSymbol(str, [&penalty](uint32_t sym) {penalty.Add(sym);});
+      return penalty.GetResult();
+    }
+    
+    static void Translate(StringView str, Utf8Builder& result)
+    {
+      ForEachSymbol(str, [&result](uint32_t sym) {result.Add(sym);});
+    }
+  private:
+    //str should be checked before
+    template<class Callback>
+    static void ForEachSymbol(StringView str, const Callback& cb)
     {
-      std::vector<uint32_t> result;
-      result.reserve(str.size());
       for (auto it = str.begin(); it != str.end(); ++it)
       {
         const uint8_t s1 = *it;
         if (s1 == 0x5c)
         {
-          result.push_back(0x00a5);
+          cb(0x00a5);
         }
         else if (s1 == 0x7e)
         {
-          result.push_back(0x203e);
+          cb(0x203e);
         }
         else if (s1 < 0x80)
         {
-          result.push_back(s1);
+          cb(s1);
         }
         else if (s1 > 0xa0 && s1 < 0xe0)
         {
-          result.push_back(0xff60 + (s1 - 0xa0));
+          cb(0xff60 + (s1 - 0xa0));
         }
         else
         {
           const uint8_t s2 = *++it;
-          result.push_back(GetUnicode(s1, s2));
+          cb(GetUnicode(s1, s2));
         }
       }
-      return result;
-    }
-    
-    static const Codepage& Instance()
-    {
-      static const ShiftJIS instance;
-      return instance;
-    }
-  private:
-    ShiftJIS()
-    {
     }
 
     static uint32_t GetUnicode(uint_t s1, uint_t s2)
@@ -864,36 +896,52 @@ namespace Strings
   
   std::string Decode(StringView str)
   {
-    static const Codepage* CODEPAGES[] =
+    //in order of preference for equal penalties
+    static const Codepage8Bit CODEPAGES[] =
     {
-      &Codepage8Bit<CP866>::Instance(),
-      &Codepage8Bit<CP1251>::Instance(),
-      &Codepage8Bit<CP1250>::Instance(),
-      &Codepage8Bit<CP1252>::Instance(),
-      &ShiftJIS::Instance()
+      Codepage8Bit(&CP866::GetUnicode),
+      Codepage8Bit(&CP1251::GetUnicode),
+      Codepage8Bit(&CP1250::GetUnicode),
+      Codepage8Bit(&CP1252::GetUnicode),
     };
+    const std::size_t CODEPAGES_COUNT = sizeof(CODEPAGES) / sizeof(*CODEPAGES);
     
-    std::vector<uint32_t> bestUnicode;
-    uint_t minPenalty = std::numeric_limits<uint_t>::max();
-    for (const auto cp : CODEPAGES)
+    //score all the 8-bit codepages in a single pass
+    std::array<PenaltyCalculator, CODEPAGES_COUNT> penalties;
+    for (const auto sym : str)
     {
-      if (!cp->Check(str))
+      for (std::size_t idx = 0; idx != CODEPAGES_COUNT; ++idx)
       {
-        continue;
+        CODEPAGES[idx].Score(static_cast<uint8_t>(sym), penalties[idx]);
       }
-      auto unicode = cp->Translate(str);
-      const auto penalty = GetPenalty(unicode);
+    }
+    const Codepage8Bit* best = nullptr;
+    uint_t minPenalty = std::numeric_limits<uint_t>::max();
+    for (std::size_t idx = 0; idx != CODEPAGES_COUNT; ++idx)
+    {
+      const auto penalty = penalties[idx].GetResult();
       if (penalty <= minPenalty)
       {
         minPenalty = penalty;
-        bestUnicode.swap(unicode);
+        best = CODEPAGES + idx;
       }
       if (0 == penalty)
       {
         break;
       }
     }
-    return Utf8Builder(bestUnicode.begin(), bestUnicode.end()).GetResult();
+    //translate only the best one
+    Utf8Builder result;
+    result.Reserve(str.size());
+    if (minPenalty != 0 && ShiftJIS::Check(str) && ShiftJIS::GetPenalty(str) <= minPenalty)
+    {
+      ShiftJIS::Translate(str, result);
+    }
+    else
+    {
+      best->Translate(str, result);
+    }
+    return result.GetResult();
   }
 }
 
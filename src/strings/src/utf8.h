@@ -12,6 +12,8 @@
 
 //common includes
 #include <types.h>
+//std includes
+#include <cstring>
 
 namespace Strings
 {
@@ -89,18 +91,34 @@ namespace Strings
     std::string Result;
   };
   
+  //returns first non-ascii symbol position, checking machine word at once where possible
+  inline const Char* SkipAscii(const Char* it, const Char* lim)
+  {
+    const uint64_t HIGH_BITS = 0x8080808080808080ull;
+    for (; lim - it >= static_cast<std::ptrdiff_t>(sizeof(HIGH_BITS)); it += sizeof(HIGH_BITS))
+    {
+      uint64_t word;
+      std::memcpy(&word, it, sizeof(word));
+      if (0 != (word & HIGH_BITS))
+      {
+        break;
+      }
+    }
+    while (it != lim && 0 == (*it & 0x80))
+    {
+      ++it;
+    }
+    return it;
+  }
+
   inline bool IsUtf8(StringView str)
   {
     //https://en.wikipedia.org/wiki/UTF-8#Description
-    for (auto it = str.begin(), lim = str.end(); it != lim;)
+    for (auto it = str.data(), lim = it + str.size(); (it = SkipAscii(it, lim)) != lim;)
     {
-      //%0xxxxxx
-      const uint_t sym = *it;
+      //%1xxxxxxx
+      const uint_t sym = static_cast<uint8_t>(*it);
       ++it;
-      if (0 == (sym & 0x80))
-      {
-        continue;
-      }
       uint_t restBytes = 0;
       for (uint_t mask = 0x40; 0 != (sym & mask); ++restBytes, mask >>= 1)
       {
@@ -109,7 +127,7 @@ namespace Strings
           return false;
         }
       }
-      if (!restBytes || it + restBytes > lim)
+      if (!restBytes || lim - it < static_cast<std::ptrdiff_t>(restBytes))
       {
         return false;
       }
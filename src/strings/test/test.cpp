@@ -160,6 +160,9 @@ int main()
       TestTranscode("CP866", "\xac\xe3\xa7\xeb\xaa\xa0", "\xd0\xbc\xd1\x83\xd0\xb7\xd1\x8b\xd0\xba\xd0\xb0");
       TestTranscode("UTF-8", "\xe3\x81\xaf\xe3\x81\x98", "\xe3\x81\xaf\xe3\x81\x98");
       TestTranscode("CP1251", "\xe4\xe5\xe4\xf3\xf8\xea\xe0", "\xd0\xb4\xd0\xb5\xd0\xb4\xd1\x83\xd1\x88\xd0\xba\xd0\xb0");
+      TestTranscode("ASCII", "Long enough ASCII-only title", "Long enough ASCII-only title");
+      TestTranscode("UTF-8", "Long ASCII prefix \xe3\x81\xaf\xe3\x81\x98", "Long ASCII prefix \xe3\x81\xaf\xe3\x81\x98");
+      TestTranscode("CP1251", "1234567890 \xe4\xe5\xe4\xf3\xf8\xea\xe0", "1234567890 \xd0\xb4\xd0\xb5\xd0\xb4\xd1\x83\xd1\x88\xd0\xba\xd0\xb0");
       TestTranscode("SJIS", "\x83\x50\x83\x43\x83\x93\x82\xcc\x83\x65\x81\x5b\x83\x7d", "\xe3\x82\xb1\xe3\x82\xa4\xe3\x83\xb3\xe3\x81\xae\xe3\x83\x86\xe3\x83\xbc\xe3\x83\x9e");
     }
     std::cout << "---- Test for optimize ----" << std::endl;